@@ -0,0 +1,42 @@
+//    Copyright 2025 MaratonaCIn
+//
+//    Licensed under the Apache License, Version 2.0 (the "License");
+//    you may not use this file except in compliance with the License.
+//    You may obtain a copy of the License at
+//
+//        http://www.apache.org/licenses/LICENSE-2.0
+//
+//    Unless required by applicable law or agreed to in writing, software
+//    distributed under the License is distributed on an "AS IS" BASIS,
+//    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//    See the License for the specific language governing permissions and
+//    limitations under the License.
+
+
+#ifndef MSCR_CLI_COMMANDS_DUPLICATESCOMMAND_HPP
+#define MSCR_CLI_COMMANDS_DUPLICATESCOMMAND_HPP
+
+#include <CLI/CLI.hpp>
+#include <string>
+
+#include "cli/commands/Command.hpp"
+#include "maratona_score/analysis/DuplicateDetector.hpp"
+
+namespace MaratonaScore::CLI {
+
+class DuplicatesCommand : public Command {
+   public:
+    explicit DuplicatesCommand(::CLI::App& app);
+
+    void execute() override;
+
+   private:
+    std::string dataPath = "./data/";
+    std::string settingsPath = "./settings/";
+    std::string outputPath = "./duplicates.csv";
+    DuplicateOptions options;
+};
+
+}  // namespace MaratonaScore::CLI
+
+#endif  // MSCR_CLI_COMMANDS_DUPLICATESCOMMAND_HPP
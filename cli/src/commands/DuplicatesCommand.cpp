@@ -0,0 +1,85 @@
+//    Copyright 2025 MaratonaCIn
+//
+//    Licensed under the Apache License, Version 2.0 (the "License");
+//    you may not use this file except in compliance with the License.
+//    You may obtain a copy of the License at
+//
+//        http://www.apache.org/licenses/LICENSE-2.0
+//
+//    Unless required by applicable law or agreed to in writing, software
+//    distributed under the License is distributed on an "AS IS" BASIS,
+//    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//    See the License for the specific language governing permissions and
+//    limitations under the License.
+
+
+#include "cli/commands/DuplicatesCommand.hpp"
+
+#include <fstream>
+#include <iostream>
+#include <stdexcept>
+
+#include "maratona_score/parser/SeasonLoader.hpp"
+#include "maratona_score/utils/Aliases.hpp"
+#include "maratona_score/utils/Blacklist.hpp"
+#include "maratona_score/utils/Settings.hpp"
+
+namespace MaratonaScore::CLI {
+
+DuplicatesCommand::DuplicatesCommand(::CLI::App& app) {
+    auto* cmd = app.add_subcommand(
+        "duplicates", "Flag accounts with near-identical solve timelines");
+
+    cmd->add_option("-d,--data", dataPath, "Season directory, .zip or .tar");
+    cmd->add_option("-s,--settings", settingsPath,
+                    "Directory with config.yaml and blacklist.txt");
+    cmd->add_option("-o,--output", outputPath, "CSV output file");
+    cmd->add_option("-t,--threshold", options.threshold,
+                    "Minimum share of coinciding solves (0-1)");
+    cmd->add_option("--tolerance", options.toleranceMinutes,
+                    "Minutes apart two solves may be and still coincide");
+    cmd->add_option("--min-solves", options.minSolves,
+                    "Ignore accounts with fewer solves in the season");
+    cmd->add_option("--bands", options.bands, "LSH bands");
+    cmd->add_option("--rows", options.rows, "MinHash values per LSH band");
+
+    cmd->callback([this]() { execute(); });
+}
+
+void DuplicatesCommand::execute() {
+    Settings::getInstance().loadFromFile(settingsPath + "/config.yaml");
+    Blacklist::loadFromFile(settingsPath + "/blacklist.txt");
+    Aliases::loadFromFile(settingsPath + "/aliases.txt");
+
+    SeasonLoader loader(dataPath);
+    DuplicateDetector detector(options);
+
+    for (const SeasonFile& file : loader.listFiles()) {
+        try {
+            detector.addContest(loader.load(file));
+        } catch (const std::exception& e) {
+            std::cerr << "[WARNING] Could not load " << file.path << ": "
+                      << e.what() << '\n';
+        }
+    }
+
+    DuplicateReport report = detector.detect();
+    if (report.skippedBuckets > 0) {
+        std::cerr << "[WARNING] " << report.skippedBuckets
+                  << " LSH buckets with more than " << options.maxBucket
+                  << " accounts were not expanded\n";
+    }
+
+    std::ofstream out(outputPath);
+    if (!out.is_open()) {
+        throw std::runtime_error("Could not open output file: " + outputPath);
+    }
+    DuplicateDetector::renderCSV(out, report);
+
+    std::cout << "[INFO] " << report.pairs.size() << " pairs flagged among "
+              << report.contestants << " accounts (" << report.candidates
+              << " candidate pairs checked), written to " << outputPath
+              << '\n';
+}
+
+}  // namespace MaratonaScore::CLI
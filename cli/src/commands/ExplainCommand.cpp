@@ -0,0 +1,76 @@
+//    Copyright 2025 MaratonaCIn
+//
+//    Licensed under the Apache License, Version 2.0 (the "License");
+//    you may not use this file except in compliance with the License.
+//    You may obtain a copy of the License at
+//
+//        http://www.apache.org/licenses/LICENSE-2.0
+//
+//    Unless required by applicable law or agreed to in writing, software
+//    distributed under the License is distributed on an "AS IS" BASIS,
+//    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//    See the License for the specific language governing permissions and
+//    limitations under the License.
+
+
+#include "cli/commands/ExplainCommand.hpp"
+
+#include <iomanip>
+#include <iostream>
+
+#include "maratona_score/models/Scoreboard.hpp"
+#include "maratona_score/parser/SeasonLoader.hpp"
+#include "maratona_score/utils/Aliases.hpp"
+#include "maratona_score/utils/Blacklist.hpp"
+#include "maratona_score/utils/Settings.hpp"
+
+namespace MaratonaScore::CLI {
+
+ExplainCommand::ExplainCommand(::CLI::App& app) {
+    auto* cmd = app.add_subcommand(
+        "explain", "Show how a contestant's total was computed");
+
+    cmd->add_option("-d,--data", dataPath, "Season directory, .zip or .tar");
+    cmd->add_option("-s,--settings", settingsPath,
+                    "Directory with config.yaml and blacklist.txt");
+    cmd->add_option("-t,--team", teamID, "Team ID")->required();
+
+    cmd->callback([this]() { execute(); });
+}
+
+void ExplainCommand::execute() {
+    Settings::getInstance().loadFromFile(settingsPath + "/config.yaml");
+    Blacklist::loadFromFile(settingsPath + "/blacklist.txt");
+    Aliases::loadFromFile(settingsPath + "/aliases.txt");
+
+    Scoreboard scoreboard;
+    SeasonLoader(dataPath).populate(scoreboard);
+
+    Explanation explanation = scoreboard.explain(teamID);
+    std::ostream& os = std::cout;
+
+    os << "Contestant: " << explanation.teamID << "\n\n";
+    os << std::left << std::setw(10) << "Contest" << std::right
+       << std::setw(10) << "Value" << std::setw(8) << "Solved"
+       << std::setw(10) << "Solve" << std::setw(10) << "Upsolved"
+       << std::setw(10) << "Upsolve" << std::setw(10) << "Bonus" << "\n";
+
+    os << std::fixed << std::setprecision(2);
+    for (const ContestBreakdown& contest : explanation.contests) {
+        os << std::left << std::setw(10) << contest.contestId << std::right
+           << std::setw(10) << toDouble(contest.problemValue) << std::setw(8)
+           << contest.solved << std::setw(10) << toDouble(contest.solve)
+           << std::setw(10) << contest.upsolved << std::setw(10)
+           << toDouble(contest.upsolve) << std::setw(10)
+           << toDouble(contest.bonus)
+           << (contest.dropped ? "  dropped (solve and bonus)" : "") << "\n";
+    }
+
+    os << "\nContest " << toDouble(explanation.contestScore) << " + Homework "
+       << toDouble(explanation.homeworkScore) << " + Upsolved "
+       << toDouble(explanation.upsolvedScore) << " + Bonus "
+       << toDouble(explanation.bonusScore) << " = "
+       << toDouble(explanation.totalScore) << "\n";
+}
+
+}  // namespace MaratonaScore::CLI
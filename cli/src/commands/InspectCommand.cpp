@@ -0,0 +1,129 @@
+//    Copyright 2025 MaratonaCIn
+//
+//    Licensed under the Apache License, Version 2.0 (the "License");
+//    you may not use this file except in compliance with the License.
+//    You may obtain a copy of the License at
+//
+//        http://www.apache.org/licenses/LICENSE-2.0
+//
+//    Unless required by applicable law or agreed to in writing, software
+//    distributed under the License is distributed on an "AS IS" BASIS,
+//    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//    See the License for the specific language governing permissions and
+//    limitations under the License.
+
+#include "cli/commands/InspectCommand.hpp"
+
+#include <iomanip>
+#include <iostream>
+#include <optional>
+
+#include "maratona_score/analysis/AnalyticsCube.hpp"
+#include "maratona_score/parser/SeasonLoader.hpp"
+#include "maratona_score/utils/Aliases.hpp"
+#include "maratona_score/utils/Blacklist.hpp"
+#include "maratona_score/utils/Settings.hpp"
+
+namespace MaratonaScore::CLI {
+
+namespace {
+
+void printHeader(std::ostream& os, const std::string& label) {
+    os << std::left << std::setw(24) << label << std::right << std::setw(8)
+       << "Opp." << std::setw(8) << "Solved" << std::setw(8) << "Rate"
+       << std::setw(10) << "Upsolved" << std::setw(10) << "First AC"
+       << std::setw(10) << "Tries/AC" << std::setw(12) << "Upsolve lag"
+       << "\n";
+}
+
+void printRow(std::ostream& os, const std::string& label,
+              const CubeAggregate& agg) {
+    os << std::left << std::setw(24) << label << std::right << std::setw(8)
+       << agg.opportunities << std::setw(8) << agg.solved << std::setw(7)
+       << std::fixed << std::setprecision(1) << agg.solveRate() * 100 << "%"
+       << std::setw(10) << agg.upsolved << std::setw(10)
+       << (agg.firstSolveTime < 0 ? std::string("-")
+                                  : std::to_string(agg.firstSolveTime))
+       << std::setw(10) << std::setprecision(2) << agg.meanAttemptsBeforeAC()
+       << std::setw(12) << std::setprecision(0) << agg.meanUpsolveLatency()
+       << "\n";
+}
+
+void printHistogram(std::ostream& os, const CubeAggregate& agg) {
+    os << "\nWrong tries before AC:\n";
+    for (int i = 0; i < CubeAggregate::ATTEMPT_BUCKETS; i++) {
+        os << "  " << std::setw(2) << i
+           << (i == CubeAggregate::ATTEMPT_BUCKETS - 1 ? "+" : " ") << "  "
+           << agg.attemptsHistogram[i] << "\n";
+    }
+}
+
+}  // namespace
+
+InspectCommand::InspectCommand(::CLI::App& app) {
+    auto* cmd = app.add_subcommand("inspect", "Analyze contest data");
+
+    cmd->add_option("-d,--data", dataPath, "Season directory, .zip or .tar");
+    cmd->add_option("-s,--settings", settingsPath,
+                    "Directory with config.yaml and blacklist.txt");
+    cmd->add_option("-c,--contest", contestId, "Contest ID (e.g. 3, H3, FINALS)");
+    cmd->add_option("-p,--problem", problemId, "Problem label (needs --contest)");
+    cmd->add_option("-t,--team", teamID, "Team ID");
+    cmd->add_option("--type", type, "Restrict to 'contest' or 'homework'")
+        ->check(::CLI::IsMember({"contest", "homework"}));
+
+    cmd->callback([this]() { execute(); });
+}
+
+void InspectCommand::execute() {
+    Settings::getInstance().loadFromFile(settingsPath + "/config.yaml");
+    Blacklist::loadFromFile(settingsPath + "/blacklist.txt");
+    Aliases::loadFromFile(settingsPath + "/aliases.txt");
+
+    AnalyticsCube cube(SeasonLoader(dataPath).loadAll());
+
+    CubeSlice slice;
+    if (!contestId.empty()) slice.contest = contestId;
+    if (!problemId.empty()) slice.problem = problemId;
+    if (!teamID.empty()) slice.contestant = teamID;
+    if (!type.empty()) slice.type = (type == "homework") ? HOMEWORK : CONTEST;
+
+    std::ostream& os = std::cout;
+
+    if (slice.contest && slice.problem) {
+        CubeAggregate agg = cube.slice(slice);
+        printHeader(os, "Problem");
+        printRow(os, contestId + "/" + problemId, agg);
+        if (!slice.contestant) {
+            const std::string& first = cube.getFirstSolver(contestId, problemId);
+            os << "\nFirst solver: " << (first.empty() ? "-" : first) << "\n";
+        }
+        printHistogram(os, agg);
+        return;
+    }
+
+    if (slice.contest) {
+        printHeader(os, "Problem");
+        for (const auto& problem : cube.getProblemIds(contestId)) {
+            CubeSlice cell = slice;
+            cell.problem = problem;
+            printRow(os, problem, cube.slice(cell));
+        }
+        printRow(os, "Total", cube.slice(slice));
+        return;
+    }
+
+    printHeader(os, "Contest");
+    for (const auto& contest : cube.getContestIds()) {
+        if (slice.type && cube.getContestType(contest) != *slice.type) continue;
+
+        CubeSlice row = slice;
+        row.contest = contest;
+        CubeAggregate agg = cube.slice(row);
+        if (slice.contestant && agg.opportunities == 0) continue;
+        printRow(os, contest, agg);
+    }
+    printRow(os, "Total", cube.slice(slice));
+}
+
+}  // namespace MaratonaScore::CLI
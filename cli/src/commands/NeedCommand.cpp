@@ -0,0 +1,70 @@
+//    Copyright 2025 MaratonaCIn
+//
+//    Licensed under the Apache License, Version 2.0 (the "License");
+//    you may not use this file except in compliance with the License.
+//    You may obtain a copy of the License at
+//
+//        http://www.apache.org/licenses/LICENSE-2.0
+//
+//    Unless required by applicable law or agreed to in writing, software
+//    distributed under the License is distributed on an "AS IS" BASIS,
+//    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//    See the License for the specific language governing permissions and
+//    limitations under the License.
+
+
+#include "cli/commands/NeedCommand.hpp"
+
+#include <fstream>
+#include <iostream>
+#include <stdexcept>
+
+#include "maratona_score/analysis/StandingsIndex.hpp"
+#include "maratona_score/models/Scoreboard.hpp"
+#include "maratona_score/parser/SeasonLoader.hpp"
+#include "maratona_score/utils/Aliases.hpp"
+#include "maratona_score/utils/Blacklist.hpp"
+#include "maratona_score/utils/Settings.hpp"
+
+namespace MaratonaScore::CLI {
+
+NeedCommand::NeedCommand(::CLI::App& app) {
+    auto* cmd = app.add_subcommand(
+        "need", "Minimum additional score to reach a target rank");
+
+    cmd->add_option("-d,--data", dataPath, "Season directory, .zip or .tar");
+    cmd->add_option("-s,--settings", settingsPath,
+                    "Directory with config.yaml and blacklist.txt");
+    cmd->add_option("-o,--output", outputPath, "CSV output (default: stdout)");
+    cmd->add_option("-t,--team", teamID, "Only this contestant");
+    cmd->add_option("-k,--rank", targetRank, "Target rank");
+
+    cmd->callback([this]() { execute(); });
+}
+
+void NeedCommand::execute() {
+    Settings::getInstance().loadFromFile(settingsPath + "/config.yaml");
+    Blacklist::loadFromFile(settingsPath + "/blacklist.txt");
+    Aliases::loadFromFile(settingsPath + "/aliases.txt");
+
+    Scoreboard scoreboard;
+    SeasonLoader(dataPath).populate(scoreboard);
+
+    StandingsIndex index(scoreboard);
+    std::vector<Requirement> requirements =
+        teamID.empty() ? index.queryAll(targetRank)
+                       : std::vector<Requirement>{index.query(teamID, targetRank)};
+
+    if (outputPath.empty()) {
+        StandingsIndex::renderCSV(std::cout, requirements);
+        return;
+    }
+
+    std::ofstream out(outputPath);
+    if (!out.is_open()) {
+        throw std::runtime_error("Could not open output file: " + outputPath);
+    }
+    StandingsIndex::renderCSV(out, requirements);
+}
+
+}  // namespace MaratonaScore::CLI
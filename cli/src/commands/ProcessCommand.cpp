@@ -0,0 +1,324 @@
+//    Copyright 2025 MaratonaCIn
+//
+//    Licensed under the Apache License, Version 2.0 (the "License");
+//    you may not use this file except in compliance with the License.
+//    You may obtain a copy of the License at
+//
+//        http://www.apache.org/licenses/LICENSE-2.0
+//
+//    Unless required by applicable law or agreed to in writing, software
+//    distributed under the License is distributed on an "AS IS" BASIS,
+//    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//    See the License for the specific language governing permissions and
+//    limitations under the License.
+
+
+#include "cli/commands/ProcessCommand.hpp"
+
+#include <chrono>
+#include <cstdint>
+#include <cstdlib>
+#include <filesystem>
+#include <fstream>
+#include <iostream>
+#include <memory>
+#include <stdexcept>
+#include <thread>
+#include <vector>
+
+#include "maratona_score/models/Scoreboard.hpp"
+#include "maratona_score/models/StreamingScoreboard.hpp"
+#include "maratona_score/output/SharedScoreboard.hpp"
+#include "maratona_score/output/StandingsDelta.hpp"
+#include "maratona_score/output/XlsxExport.hpp"
+#include "maratona_score/parser/SeasonLoader.hpp"
+#include "maratona_score/parser/ShardedSeason.hpp"
+#include "maratona_score/utils/Aliases.hpp"
+#include "maratona_score/utils/Blacklist.hpp"
+#include "maratona_score/utils/Settings.hpp"
+
+#if defined(__APPLE__)
+#include <mach-o/dyld.h>
+#endif
+
+namespace MaratonaScore::CLI {
+
+#ifndef _WIN32
+namespace {
+
+// Workers are started through the shell (std::system), so every argument is
+// single-quoted for a POSIX shell. cmd.exe has no quoting that survives
+// arbitrary paths, so --shards is refused on Windows (see executeSharded).
+std::string shellQuote(const std::string& text) {
+    std::string quoted = "'";
+    for (char c : text) {
+        quoted += c == '\'' ? std::string("'\\''") : std::string(1, c);
+    }
+    return quoted + "'";
+}
+
+// The workers must run this very binary, not whatever is first on PATH.
+std::string selfExecutable() {
+#if defined(__APPLE__)
+    uint32_t size = 0;
+    _NSGetExecutablePath(nullptr, &size);
+    std::string path(size, '\0');
+    if (_NSGetExecutablePath(path.data(), &size) == 0) {
+        path.resize(path.find('\0'));
+        return path;
+    }
+#else
+    std::error_code error;
+    auto path = std::filesystem::read_symlink("/proc/self/exe", error);
+    if (!error) return path.string();
+#endif
+    throw std::runtime_error(
+        "Could not find this executable's path to start the shard workers");
+}
+
+// Removes the temporary shard directory however executeSharded exits.
+struct RemoveOnExit {
+    std::filesystem::path dir;
+    bool active;
+
+    ~RemoveOnExit() {
+        if (!active) return;
+        std::error_code error;
+        std::filesystem::remove_all(dir, error);
+    }
+};
+
+}  // namespace
+#endif
+
+ProcessCommand::ProcessCommand(::CLI::App& app) {
+    auto* cmd = app.add_subcommand("process", "Compute the season scoreboard");
+
+    cmd->add_option("-d,--data", dataPath, "Season directory, .zip or .tar");
+    cmd->add_option("-s,--settings", settingsPath,
+                    "Directory with config.yaml and blacklist.txt");
+    cmd->add_option("-o,--output", outputPath, "CSV output file");
+    auto* ratings = cmd->add_option(
+        "--ratings", ratingsPath,
+        "Ratings carried across seasons: read if it exists, written back "
+        "after the season");
+    auto* snapshot = cmd->add_option(
+        "--snapshot", snapshotPath,
+        "Standings as last published: compared against, then replaced");
+    cmd->add_option("--delta", deltaPath,
+                    "Write the rows changed since the snapshot to this CSV")
+        ->needs(snapshot);
+    auto* shm = cmd->add_option(
+        "--shm", sharedName,
+        "Also publish the standings to this shared-memory segment for local "
+        "readers");
+    auto* xlsx = cmd->add_option(
+        "--xlsx", xlsxPath,
+        "Also write the standings with per-round columns as .xlsx");
+    auto* streamingFlag =
+        cmd->add_flag("--streaming", streaming,
+                      "Reduce each file to per-contestant score rows as it "
+                      "is read (bounded memory for very large seasons)")
+            ->excludes(xlsx);
+    auto* sharded =
+        cmd->add_option("--shards", shards,
+                        "Split the contestants over this many worker "
+                        "processes and merge their standings")
+            ->check(::CLI::PositiveNumber);
+    for (auto* other : {streamingFlag, xlsx, snapshot, ratings, shm}) {
+        sharded->excludes(other);
+    }
+    cmd->add_option("--launcher", launcher,
+                    "Command prefix for each worker, e.g. \"ssh node{shard}\" "
+                    "({shard} is replaced by the shard index)")
+        ->needs(sharded);
+    cmd->add_option("--shard-dir", shardDir,
+                    "Directory for the workers' tallies and runs (shared by "
+                    "all machines; default: a temporary directory)")
+        ->needs(sharded);
+
+    cmd->callback([this]() { execute(); });
+}
+
+void ProcessCommand::execute() {
+    Settings::getInstance().loadFromFile(settingsPath + "/config.yaml");
+    Blacklist::loadFromFile(settingsPath + "/blacklist.txt");
+    Aliases::loadFromFile(settingsPath + "/aliases.txt");
+
+    std::ofstream out(outputPath);
+    if (!out.is_open()) {
+        throw std::runtime_error("Could not open output file: " + outputPath);
+    }
+
+    if (shards > 0) {
+        executeSharded(out);
+        std::cout << "[INFO] Scoreboard written to " << outputPath << '\n';
+        return;
+    }
+
+    auto run = [&](auto& scoreboard) {
+        const bool rated =
+            Settings::getInstance().RATING_ENABLED && !ratingsPath.empty();
+        if (rated && std::filesystem::exists(ratingsPath)) {
+            scoreboard.getRatings().load(ratingsPath);
+        }
+
+        SeasonLoader(dataPath).populate(scoreboard);
+        scoreboard.renderCSV(out);
+
+        if (rated) scoreboard.getRatings().save(ratingsPath);
+
+        if (!sharedName.empty()) {
+            uint64_t generation =
+                SharedScoreboard(sharedName)
+                    .publish(StandingsSnapshot::fromScoreboard(scoreboard));
+            std::cout << "[INFO] Published generation " << generation
+                      << " to shared memory " << sharedName << '\n';
+        }
+
+        if (!snapshotPath.empty()) {
+            StandingsSnapshot current =
+                StandingsSnapshot::fromScoreboard(scoreboard);
+            StandingsSnapshot previous;
+            if (std::filesystem::exists(snapshotPath)) {
+                previous = StandingsSnapshot::load(snapshotPath);
+            }
+
+            if (!deltaPath.empty()) {
+                std::ofstream delta(deltaPath);
+                if (!delta.is_open()) {
+                    throw std::runtime_error("Could not open delta file: " +
+                                             deltaPath);
+                }
+                StandingsDelta changes(previous, current);
+                changes.renderCSV(delta);
+                std::cout << "[INFO] " << changes.getEntries().size()
+                          << " changed rows written to " << deltaPath << '\n';
+            }
+
+            current.save(snapshotPath);
+        }
+    };
+
+    if (streaming) {
+        StreamingScoreboard scoreboard;
+        run(scoreboard);
+    } else {
+        Scoreboard scoreboard;
+        run(scoreboard);
+
+        if (!xlsxPath.empty()) {
+            std::ofstream xlsx(xlsxPath, std::ios::binary);
+            if (!xlsx.is_open()) {
+                throw std::runtime_error("Could not open output file: " +
+                                         xlsxPath);
+            }
+            exportScoreboardXlsx(scoreboard, xlsx);
+            std::cout << "[INFO] Spreadsheet written to " << xlsxPath << '\n';
+        }
+    }
+
+    std::cout << "[INFO] Scoreboard written to " << outputPath << '\n';
+}
+
+void ProcessCommand::executeSharded(std::ostream& out) {
+    namespace fs = std::filesystem;
+
+#ifdef _WIN32
+    (void)out;
+    throw std::runtime_error(
+        "--shards starts its workers through a POSIX shell and is not "
+        "available on Windows");
+#else
+    if (Settings::getInstance().RATING_ENABLED) {
+        std::cerr << "[WARNING] Ratings are not computed with --shards; the "
+                     "Rating column is left out\n";
+    }
+
+    const bool temporary = shardDir.empty();
+    fs::path dir = shardDir;
+    if (temporary) {
+        dir = fs::temp_directory_path() /
+              ("maratona-shards-" +
+               std::to_string(
+                   std::chrono::steady_clock::now().time_since_epoch().count()));
+    }
+    fs::create_directories(dir);
+    RemoveOnExit cleanup{dir, temporary};
+
+    const std::string executable = selfExecutable();
+    auto shardFile = [&](const std::string& kind, int shard) {
+        return (dir / (kind + "-" + std::to_string(shard) + ".txt")).string();
+    };
+
+    // Runs one phase on every shard in parallel; each worker is a process.
+    auto runPhase = [&](const std::string& phase, const std::string& extra) {
+        std::vector<int> status(shards);
+        std::vector<std::thread> threads;
+        for (int shard = 0; shard < shards; shard++) {
+            std::string prefix = launcher;
+            for (size_t at = prefix.find("{shard}"); at != std::string::npos;
+                 at = prefix.find("{shard}", at)) {
+                prefix.replace(at, 7, std::to_string(shard));
+            }
+
+            std::string command =
+                (prefix.empty() ? "" : prefix + " ") + shellQuote(executable) +
+                " shard-worker --phase " + phase + " --shard " +
+                std::to_string(shard) + " --shards " + std::to_string(shards) +
+                " -d " + shellQuote(dataPath) + " -s " +
+                shellQuote(settingsPath) + extra + " -o " +
+                shellQuote(shardFile(phase, shard));
+
+            threads.emplace_back([&status, shard, command]() {
+                status[shard] = std::system(command.c_str());
+            });
+        }
+        for (auto& thread : threads) thread.join();
+
+        for (int shard = 0; shard < shards; shard++) {
+            if (status[shard] != 0) {
+                throw std::runtime_error("Shard worker " + std::to_string(shard) +
+                                         " failed in the " + phase + " phase");
+            }
+        }
+    };
+
+    runPhase("tally", "");
+
+    std::vector<SeasonTally> tallies;
+    for (int shard = 0; shard < shards; shard++) {
+        std::ifstream in(shardFile("tally", shard));
+        if (!in.is_open()) {
+            throw std::runtime_error("Missing shard tally: " +
+                                     shardFile("tally", shard));
+        }
+        tallies.push_back(SeasonTally::load(in));
+    }
+
+    const std::string mergedPath = (dir / "tally.txt").string();
+    {
+        std::ofstream merged(mergedPath);
+        SeasonTally::merge(tallies).save(merged);
+        if (!merged) {
+            throw std::runtime_error("Could not write " + mergedPath);
+        }
+    }
+
+    runPhase("score", " --tally " + shellQuote(mergedPath));
+
+    std::vector<std::unique_ptr<std::ifstream>> files;
+    std::vector<std::istream*> runs;
+    for (int shard = 0; shard < shards; shard++) {
+        files.push_back(std::make_unique<std::ifstream>(shardFile("score", shard)));
+        if (!files.back()->is_open()) {
+            throw std::runtime_error("Missing shard run: " +
+                                     shardFile("score", shard));
+        }
+        runs.push_back(files.back().get());
+    }
+    mergeShardRuns(runs, out);
+#endif
+}
+
+}  // namespace MaratonaScore::CLI
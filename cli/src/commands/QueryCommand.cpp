@@ -0,0 +1,91 @@
+//    Copyright 2025 MaratonaCIn
+//
+//    Licensed under the Apache License, Version 2.0 (the "License");
+//    you may not use this file except in compliance with the License.
+//    You may obtain a copy of the License at
+//
+//        http://www.apache.org/licenses/LICENSE-2.0
+//
+//    Unless required by applicable law or agreed to in writing, software
+//    distributed under the License is distributed on an "AS IS" BASIS,
+//    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//    See the License for the specific language governing permissions and
+//    limitations under the License.
+
+#include "cli/commands/QueryCommand.hpp"
+
+#include <filesystem>
+#include <fstream>
+#include <iostream>
+#include <stdexcept>
+
+#include "maratona_score/analysis/Query.hpp"
+#include "maratona_score/parser/SeasonLoader.hpp"
+#include "maratona_score/utils/Aliases.hpp"
+#include "maratona_score/utils/Blacklist.hpp"
+#include "maratona_score/utils/Settings.hpp"
+
+namespace MaratonaScore::CLI {
+
+namespace {
+
+// "2025=archive/s25.zip" names the season explicitly; otherwise it is named
+// after the directory or bundle ("archive/2025.zip" -> 2025).
+std::pair<std::string, std::string> seasonOf(const std::string& spec) {
+    size_t equals = spec.find('=');
+    if (equals != std::string::npos && !std::filesystem::exists(spec)) {
+        return {spec.substr(0, equals), spec.substr(equals + 1)};
+    }
+    std::filesystem::path path(spec);
+    if (!path.has_filename()) path = path.parent_path();
+    return {path.stem().string(), spec};
+}
+
+}  // namespace
+
+QueryCommand::QueryCommand(::CLI::App& app) {
+    auto* cmd = app.add_subcommand(
+        "query", "Filter, group and aggregate round results across seasons");
+
+    cmd->add_option("query", queryText,
+                    "e.g. 'where type = \"contest\" group by team "
+                    "having count() >= 3'")
+        ->required();
+    cmd->add_option("-d,--data", dataPaths,
+                    "Season directory, .zip or .tar; repeat for more seasons "
+                    "(name=path to name one)");
+    cmd->add_option("-s,--settings", settingsPath,
+                    "Directory with config.yaml and blacklist.txt");
+    cmd->add_option("-o,--output", outputPath, "CSV output file");
+
+    cmd->callback([this]() { execute(); });
+}
+
+void QueryCommand::execute() {
+    // Parse first, so a typo fails before any season is read.
+    Query query = Query::parse(queryText);
+
+    Settings::getInstance().loadFromFile(settingsPath + "/config.yaml");
+    Blacklist::loadFromFile(settingsPath + "/blacklist.txt");
+    Aliases::loadFromFile(settingsPath + "/aliases.txt");
+
+    if (dataPaths.empty()) dataPaths.push_back("./data/");
+
+    QueryTable table;
+    for (const std::string& spec : dataPaths) {
+        auto [season, path] = seasonOf(spec);
+        table.addSeason(season, SeasonLoader(path).loadAll());
+    }
+
+    std::ofstream out(outputPath);
+    if (!out.is_open()) {
+        throw std::runtime_error("Could not open output file: " + outputPath);
+    }
+
+    QueryResult result = query.run(table);
+    result.renderCSV(out);
+    std::cout << "[INFO] " << result.rows.size() << " rows from "
+              << table.size() << " results written to " << outputPath << '\n';
+}
+
+}  // namespace MaratonaScore::CLI
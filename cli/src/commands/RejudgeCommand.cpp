@@ -0,0 +1,98 @@
+//    Copyright 2025 MaratonaCIn
+//
+//    Licensed under the Apache License, Version 2.0 (the "License");
+//    you may not use this file except in compliance with the License.
+//    You may obtain a copy of the License at
+//
+//        http://www.apache.org/licenses/LICENSE-2.0
+//
+//    Unless required by applicable law or agreed to in writing, software
+//    distributed under the License is distributed on an "AS IS" BASIS,
+//    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//    See the License for the specific language governing permissions and
+//    limitations under the License.
+
+
+#include "cli/commands/RejudgeCommand.hpp"
+
+#include <algorithm>
+#include <fstream>
+#include <iostream>
+#include <stdexcept>
+#include <utility>
+#include <vector>
+
+#include "maratona_score/models/Scoreboard.hpp"
+#include "maratona_score/parser/RejudgeParser.hpp"
+#include "maratona_score/parser/SeasonLoader.hpp"
+#include "maratona_score/utils/Aliases.hpp"
+#include "maratona_score/utils/Blacklist.hpp"
+#include "maratona_score/utils/Settings.hpp"
+
+namespace MaratonaScore::CLI {
+
+RejudgeCommand::RejudgeCommand(::CLI::App& app) {
+    auto* cmd = app.add_subcommand(
+        "rejudge", "Apply rejudge patches to the season scoreboard");
+
+    cmd->add_option("-d,--data", dataPath, "Season directory, .zip or .tar");
+    cmd->add_option("-s,--settings", settingsPath,
+                    "Directory with config.yaml and blacklist.txt");
+    cmd->add_option("-p,--patches", patchPath, "Rejudge file")->required();
+    cmd->add_option("-o,--output", outputPath, "CSV output file");
+    cmd->add_flag("--add-teams", addTeams,
+                  "Apply patches for teams absent from the round's sheet");
+
+    cmd->callback([this]() { execute(); });
+}
+
+void RejudgeCommand::execute() {
+    Settings::getInstance().loadFromFile(settingsPath + "/config.yaml");
+    Blacklist::loadFromFile(settingsPath + "/blacklist.txt");
+    Aliases::loadFromFile(settingsPath + "/aliases.txt");
+
+    std::vector<RejudgePatch> patches = RejudgeParser().parse(patchPath);
+
+    // A one-shot run has nothing to patch but the season itself, so it pays
+    // for a full load; only callers that keep the scoreboard in memory get
+    // the incremental cost of applyRejudge.
+    Scoreboard scoreboard;
+    std::vector<std::pair<SeasonFile, Contest>> season;
+    SeasonLoader(dataPath).populate(scoreboard, season);
+
+    int applied = 0;
+    for (const RejudgePatch& patch : patches) {
+        auto it = std::find_if(season.begin(), season.end(),
+                               [&](const auto& entry) {
+                                   return entry.second.getId() ==
+                                          patch.contestId;
+                               });
+        if (it == season.end()) {
+            std::cerr << "[WARNING] Rejudge for unknown contest "
+                      << patch.contestId << " ignored\n";
+            continue;
+        }
+
+        if (!addTeams &&
+            !it->second.getPerformances().count(patch.teamID)) {
+            std::cerr << "[WARNING] " << patch.teamID << " is not in contest "
+                      << patch.contestId
+                      << "; rejudge ignored (use --add-teams to add it)\n";
+            continue;
+        }
+
+        scoreboard.applyRejudge(it->second, it->first.index, patch);
+        applied++;
+    }
+
+    std::ofstream out(outputPath);
+    if (!out.is_open()) {
+        throw std::runtime_error("Could not open output file: " + outputPath);
+    }
+    scoreboard.renderCSV(out);
+
+    std::cout << "[INFO] Applied " << applied << " rejudge patches, scoreboard "
+              << "written to " << outputPath << '\n';
+}
+
+}  // namespace MaratonaScore::CLI
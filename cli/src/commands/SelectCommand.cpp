@@ -0,0 +1,81 @@
+//    Copyright 2025 MaratonaCIn
+//
+//    Licensed under the Apache License, Version 2.0 (the "License");
+//    you may not use this file except in compliance with the License.
+//    You may obtain a copy of the License at
+//
+//        http://www.apache.org/licenses/LICENSE-2.0
+//
+//    Unless required by applicable law or agreed to in writing, software
+//    distributed under the License is distributed on an "AS IS" BASIS,
+//    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//    See the License for the specific language governing permissions and
+//    limitations under the License.
+
+
+#include "cli/commands/SelectCommand.hpp"
+
+#include <fstream>
+#include <iostream>
+#include <stdexcept>
+
+#include "maratona_score/analysis/SelectionOptimizer.hpp"
+#include "maratona_score/models/Scoreboard.hpp"
+#include "maratona_score/parser/SeasonLoader.hpp"
+#include "maratona_score/utils/Aliases.hpp"
+#include "maratona_score/utils/Blacklist.hpp"
+#include "maratona_score/utils/Settings.hpp"
+
+namespace MaratonaScore::CLI {
+
+SelectCommand::SelectCommand(::CLI::App& app) {
+    auto* cmd = app.add_subcommand(
+        "select", "Best selection that satisfies the selection constraints");
+
+    cmd->add_option("-d,--data", dataPath, "Season directory, .zip or .tar");
+    cmd->add_option("-s,--settings", settingsPath,
+                    "Directory with config.yaml and blacklist.txt");
+    cmd->add_option("-c,--constraints", constraintsPath,
+                    "Constraints YAML (default: <settings>/selection.yaml)");
+    cmd->add_option("-o,--output", outputPath, "CSV output (default: stdout)");
+    cmd->add_option("-k,--size", selectionSize,
+                    "Number of teams (overrides the constraints file)");
+
+    cmd->callback([this]() { execute(); });
+}
+
+void SelectCommand::execute() {
+    Settings::getInstance().loadFromFile(settingsPath + "/config.yaml");
+    Blacklist::loadFromFile(settingsPath + "/blacklist.txt");
+    Aliases::loadFromFile(settingsPath + "/aliases.txt");
+
+    SelectionConstraints constraints = SelectionConstraints::loadFromFile(
+        constraintsPath.empty() ? settingsPath + "/selection.yaml"
+                                : constraintsPath);
+    if (selectionSize > 0) constraints.size = selectionSize;
+
+    Scoreboard scoreboard;
+    SeasonLoader(dataPath).populate(scoreboard);
+
+    SelectionResult result = SelectionOptimizer(scoreboard).solve(constraints);
+    if (!result.feasible) {
+        throw std::runtime_error("No selection satisfies the constraints");
+    }
+
+    if (outputPath.empty()) {
+        SelectionOptimizer::renderCSV(std::cout, result);
+        return;
+    }
+
+    std::ofstream out(outputPath);
+    if (!out.is_open()) {
+        throw std::runtime_error("Could not open output file: " + outputPath);
+    }
+    SelectionOptimizer::renderCSV(out, result);
+
+    std::cout << "[INFO] Selected " << result.selected.size()
+              << " teams, total score " << toDouble(result.totalScore)
+              << " (" << result.nodes << " search nodes)\n";
+}
+
+}  // namespace MaratonaScore::CLI
@@ -0,0 +1,87 @@
+//    Copyright 2025 MaratonaCIn
+//
+//    Licensed under the Apache License, Version 2.0 (the "License");
+//    you may not use this file except in compliance with the License.
+//    You may obtain a copy of the License at
+//
+//        http://www.apache.org/licenses/LICENSE-2.0
+//
+//    Unless required by applicable law or agreed to in writing, software
+//    distributed under the License is distributed on an "AS IS" BASIS,
+//    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//    See the License for the specific language governing permissions and
+//    limitations under the License.
+
+
+#include "cli/commands/ShardWorkerCommand.hpp"
+
+#include <algorithm>
+#include <fstream>
+#include <stdexcept>
+#include <thread>
+
+#include "maratona_score/models/Scoreboard.hpp"
+#include "maratona_score/parser/ShardedSeason.hpp"
+#include "maratona_score/utils/Aliases.hpp"
+#include "maratona_score/utils/Blacklist.hpp"
+#include "maratona_score/utils/Settings.hpp"
+
+namespace MaratonaScore::CLI {
+
+ShardWorkerCommand::ShardWorkerCommand(::CLI::App& app) {
+    auto* cmd = app.add_subcommand("shard-worker",
+                                   "Worker process of process --shards");
+    cmd->group("");
+
+    cmd->add_option("--phase", phase, "tally or score")
+        ->required()
+        ->check(::CLI::IsMember({"tally", "score"}));
+    cmd->add_option("--shard", shard, "Index of this shard")->required();
+    cmd->add_option("--shards", shards, "Number of shards")->required();
+    cmd->add_option("-d,--data", dataPath, "Season directory, .zip or .tar");
+    cmd->add_option("-s,--settings", settingsPath,
+                    "Directory with config.yaml and blacklist.txt");
+    cmd->add_option("--tally", tallyPath, "Merged tally (score phase)");
+    cmd->add_option("-o,--output", outputPath,
+                    "Shard tally or sorted run to write")
+        ->required();
+
+    cmd->callback([this]() { execute(); });
+}
+
+void ShardWorkerCommand::execute() {
+    Settings& settings = Settings::getInstance();
+    settings.loadFromFile(settingsPath + "/config.yaml");
+    Blacklist::loadFromFile(settingsPath + "/blacklist.txt");
+    Aliases::loadFromFile(settingsPath + "/aliases.txt");
+
+    // Ratings need whole rounds, and the shards share the machine's cores.
+    settings.RATING_ENABLED = false;
+    if (settings.PARSER_THREADS == 0) {
+        settings.PARSER_THREADS = std::max(
+            1, static_cast<int>(std::thread::hardware_concurrency()) / shards);
+    }
+
+    ShardWorker worker(dataPath, {shard, shards});
+
+    std::ofstream out(outputPath);
+    if (!out.is_open()) {
+        throw std::runtime_error("Could not open output file: " + outputPath);
+    }
+
+    if (phase == "tally") {
+        worker.tally().save(out);
+        return;
+    }
+
+    std::ifstream in(tallyPath);
+    if (!in.is_open()) {
+        throw std::runtime_error("Could not open shard tally: " + tallyPath);
+    }
+
+    Scoreboard scoreboard;
+    worker.score(SeasonTally::load(in), scoreboard);
+    scoreboard.renderRun(out);
+}
+
+}  // namespace MaratonaScore::CLI
@@ -0,0 +1,74 @@
+//    Copyright 2025 MaratonaCIn
+//
+//    Licensed under the Apache License, Version 2.0 (the "License");
+//    you may not use this file except in compliance with the License.
+//    You may obtain a copy of the License at
+//
+//        http://www.apache.org/licenses/LICENSE-2.0
+//
+//    Unless required by applicable law or agreed to in writing, software
+//    distributed under the License is distributed on an "AS IS" BASIS,
+//    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//    See the License for the specific language governing permissions and
+//    limitations under the License.
+
+#include "cli/commands/SimulateCommand.hpp"
+
+#include <fstream>
+#include <iostream>
+#include <stdexcept>
+
+#include "maratona_score/models/Scoreboard.hpp"
+#include "maratona_score/parser/SeasonLoader.hpp"
+#include "maratona_score/utils/Aliases.hpp"
+#include "maratona_score/utils/Blacklist.hpp"
+#include "maratona_score/utils/Settings.hpp"
+
+namespace MaratonaScore::CLI {
+
+SimulateCommand::SimulateCommand(::CLI::App& app) {
+    auto* cmd = app.add_subcommand(
+        "simulate", "Project final selection probabilities (Monte Carlo)");
+
+    cmd->add_option("-d,--data", dataPath, "Season directory, .zip or .tar");
+    cmd->add_option("-s,--settings", settingsPath,
+                    "Directory with config.yaml and blacklist.txt");
+    cmd->add_option("-o,--output", outputPath, "CSV output (default: stdout)");
+    cmd->add_option("-k,--select", options.selectionSize,
+                    "Number of contestants selected");
+    cmd->add_option("-n,--iterations", options.iterations,
+                    "Number of simulated seasons");
+    cmd->add_option("-j,--threads", options.threads,
+                    "Worker threads (0 = all hardware threads)");
+    cmd->add_option("--buckets", options.rankBuckets,
+                    "Rank distribution columns (last one is open-ended)");
+    cmd->add_option("--seed", options.seed, "Random seed");
+    cmd->add_flag("--no-finals", skipFinals, "Do not simulate the finals");
+
+    cmd->callback([this]() { execute(); });
+}
+
+void SimulateCommand::execute() {
+    Settings::getInstance().loadFromFile(settingsPath + "/config.yaml");
+    Blacklist::loadFromFile(settingsPath + "/blacklist.txt");
+    Aliases::loadFromFile(settingsPath + "/aliases.txt");
+
+    Scoreboard scoreboard;
+    SeasonLoader(dataPath).populate(scoreboard);
+
+    options.includeFinals = !skipFinals;
+    auto projections = SelectionSimulator(scoreboard).simulate(options);
+
+    if (outputPath.empty()) {
+        SelectionSimulator::renderCSV(std::cout, projections);
+        return;
+    }
+
+    std::ofstream out(outputPath);
+    if (!out.is_open()) {
+        throw std::runtime_error("Could not open output file: " + outputPath);
+    }
+    SelectionSimulator::renderCSV(out, projections);
+}
+
+}  // namespace MaratonaScore::CLI
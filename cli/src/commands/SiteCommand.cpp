@@ -0,0 +1,67 @@
+//    Copyright 2025 MaratonaCIn
+//
+//    Licensed under the Apache License, Version 2.0 (the "License");
+//    you may not use this file except in compliance with the License.
+//    You may obtain a copy of the License at
+//
+//        http://www.apache.org/licenses/LICENSE-2.0
+//
+//    Unless required by applicable law or agreed to in writing, software
+//    distributed under the License is distributed on an "AS IS" BASIS,
+//    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//    See the License for the specific language governing permissions and
+//    limitations under the License.
+
+#include "cli/commands/SiteCommand.hpp"
+
+#include <iostream>
+#include <utility>
+#include <vector>
+
+#include "maratona_score/parser/SeasonLoader.hpp"
+#include "maratona_score/utils/Aliases.hpp"
+#include "maratona_score/utils/Blacklist.hpp"
+#include "maratona_score/utils/Settings.hpp"
+
+namespace MaratonaScore::CLI {
+
+SiteCommand::SiteCommand(::CLI::App& app) {
+    auto* cmd = app.add_subcommand(
+        "site", "Static HTML standings with a page per contestant and round");
+
+    cmd->add_option("-d,--data", dataPath, "Season directory, .zip or .tar");
+    cmd->add_option("-s,--settings", settingsPath,
+                    "Directory with config.yaml and blacklist.txt");
+    cmd->add_option("-o,--output", outputPath, "Site directory");
+    cmd->add_option("--title", options.title, "Site title");
+    cmd->add_option("-j,--threads", options.threads,
+                    "Rendering threads (0 = all hardware threads)");
+    cmd->add_flag("--no-gzip", noGzip, "Do not write .gz page variants");
+
+    cmd->callback([this]() { execute(); });
+}
+
+void SiteCommand::execute() {
+    Settings::getInstance().loadFromFile(settingsPath + "/config.yaml");
+    Blacklist::loadFromFile(settingsPath + "/blacklist.txt");
+    Aliases::loadFromFile(settingsPath + "/aliases.txt");
+
+    SeasonLoader loader(dataPath);
+    Scoreboard scoreboard;
+    std::vector<std::pair<SeasonFile, Contest>> loaded;
+    loader.populate(scoreboard, loaded);
+
+    std::vector<Contest> contests;
+    contests.reserve(loaded.size());
+    for (auto& [file, contest] : loaded) contests.push_back(std::move(contest));
+
+    options.gzip = !noGzip;
+    SiteReport report = generateSite(scoreboard, contests, outputPath, options);
+
+    std::cout << "[INFO] " << report.written << " of " << report.pages
+              << " pages written to " << outputPath;
+    if (report.removed > 0) std::cout << ", " << report.removed << " removed";
+    std::cout << '\n';
+}
+
+}  // namespace MaratonaScore::CLI
@@ -0,0 +1,71 @@
+//    Copyright 2025 MaratonaCIn
+//
+//    Licensed under the Apache License, Version 2.0 (the "License");
+//    you may not use this file except in compliance with the License.
+//    You may obtain a copy of the License at
+//
+//        http://www.apache.org/licenses/LICENSE-2.0
+//
+//    Unless required by applicable law or agreed to in writing, software
+//    distributed under the License is distributed on an "AS IS" BASIS,
+//    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//    See the License for the specific language governing permissions and
+//    limitations under the License.
+
+
+#include "cli/commands/TrajectoryCommand.hpp"
+
+#include <fstream>
+#include <iostream>
+#include <stdexcept>
+
+#include "maratona_score/analysis/RankTrajectory.hpp"
+#include "maratona_score/parser/SeasonLoader.hpp"
+#include "maratona_score/utils/Aliases.hpp"
+#include "maratona_score/utils/Blacklist.hpp"
+#include "maratona_score/utils/Settings.hpp"
+
+namespace MaratonaScore::CLI {
+
+TrajectoryCommand::TrajectoryCommand(::CLI::App& app) {
+    auto* cmd = app.add_subcommand(
+        "trajectory", "Score and rank of every contestant after each round");
+
+    cmd->add_option("-d,--data", dataPath, "Season directory, .zip or .tar");
+    cmd->add_option("-s,--settings", settingsPath,
+                    "Directory with config.yaml and blacklist.txt");
+    cmd->add_option("-o,--output", outputPath, "CSV output file");
+
+    cmd->callback([this]() { execute(); });
+}
+
+void TrajectoryCommand::execute() {
+    Settings::getInstance().loadFromFile(settingsPath + "/config.yaml");
+    Blacklist::loadFromFile(settingsPath + "/blacklist.txt");
+    Aliases::loadFromFile(settingsPath + "/aliases.txt");
+
+    std::ofstream out(outputPath);
+    if (!out.is_open()) {
+        throw std::runtime_error("Could not open output file: " + outputPath);
+    }
+
+    SeasonLoader loader(dataPath);
+    RankTrajectory trajectory;
+    RankTrajectory::renderHeader(out);
+
+    for (const SeasonFile& file : loader.listFiles()) {
+        try {
+            trajectory.addContest(loader.load(file), file.index);
+        } catch (const std::exception& e) {
+            std::cerr << "[WARNING] Could not load " << file.path << ": "
+                      << e.what() << '\n';
+            continue;
+        }
+        trajectory.renderStep(out);
+    }
+
+    std::cout << "[INFO] " << trajectory.getStep()
+              << " rounds written to " << outputPath << '\n';
+}
+
+}  // namespace MaratonaScore::CLI
@@ -1,12 +1,71 @@
+//    Copyright 2025 MaratonaCIn
+//
+//    Licensed under the Apache License, Version 2.0 (the "License");
+//    you may not use this file except in compliance with the License.
+//    You may obtain a copy of the License at
+//
+//        http://www.apache.org/licenses/LICENSE-2.0
+//
+//    Unless required by applicable law or agreed to in writing, software
+//    distributed under the License is distributed on an "AS IS" BASIS,
+//    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//    See the License for the specific language governing permissions and
+//    limitations under the License.
+
 #include <CLI/CLI.hpp>
+#include <exception>
+#include <iostream>
+#include <memory>
+#include <vector>
+
+#include "cli/commands/DuplicatesCommand.hpp"
+#include "cli/commands/ExplainCommand.hpp"
+#include "cli/commands/InspectCommand.hpp"
+#include "cli/commands/NeedCommand.hpp"
+#include "cli/commands/ProcessCommand.hpp"
+#include "cli/commands/QueryCommand.hpp"
+#include "cli/commands/RejudgeCommand.hpp"
+#include "cli/commands/SelectCommand.hpp"
+#include "cli/commands/ShardWorkerCommand.hpp"
+#include "cli/commands/SimulateCommand.hpp"
+#include "cli/commands/SiteCommand.hpp"
+#include "cli/commands/TrajectoryCommand.hpp"
 
 int main(int argc, char** argv) {
-    CLI::App app{"App description"};
+    CLI::App app{"MaratonaScore - MaratonaCIn Rating System"};
     argv = app.ensure_utf8(argv);
+    app.require_subcommand(1);
+
+    std::vector<std::unique_ptr<MaratonaScore::CLI::Command>> commands;
+    commands.push_back(
+        std::make_unique<MaratonaScore::CLI::ProcessCommand>(app));
+    commands.push_back(
+        std::make_unique<MaratonaScore::CLI::RejudgeCommand>(app));
+    commands.push_back(
+        std::make_unique<MaratonaScore::CLI::InspectCommand>(app));
+    commands.push_back(
+        std::make_unique<MaratonaScore::CLI::SimulateCommand>(app));
+    commands.push_back(std::make_unique<MaratonaScore::CLI::NeedCommand>(app));
+    commands.push_back(
+        std::make_unique<MaratonaScore::CLI::SelectCommand>(app));
+    commands.push_back(
+        std::make_unique<MaratonaScore::CLI::ExplainCommand>(app));
+    commands.push_back(
+        std::make_unique<MaratonaScore::CLI::TrajectoryCommand>(app));
+    commands.push_back(std::make_unique<MaratonaScore::CLI::SiteCommand>(app));
+    commands.push_back(
+        std::make_unique<MaratonaScore::CLI::QueryCommand>(app));
+    commands.push_back(
+        std::make_unique<MaratonaScore::CLI::DuplicatesCommand>(app));
+    commands.push_back(
+        std::make_unique<MaratonaScore::CLI::ShardWorkerCommand>(app));
 
-    std::string filename = "default";
-    app.add_option("-f,--file", filename, "A help string");
+    try {
+        CLI11_PARSE(app, argc, argv);
+    } catch (const std::exception& e) {
+        std::cerr << "Error: " << e.what() << '\n';
+        return 1;
+    }
 
-    CLI11_PARSE(app, argc, argv);
     return 0;
-}
\ No newline at end of file
+}
@@ -19,6 +19,7 @@
 #include "maratona_score/models/Contest.hpp"
 #include "maratona_score/models/Scoreboard.hpp"
 #include "maratona_score/parser/FinalParser.hpp"
+#include "maratona_score/utils/Aliases.hpp"
 #include "maratona_score/utils/Blacklist.hpp"
 #include "maratona_score/utils/Settings.hpp"
 
@@ -59,6 +60,7 @@ int main(int argc, char* argv[]) {
     Settings::getInstance().loadFromFile(settings_path + "config.yaml");
 
     Blacklist::loadFromFile(settings_path + "blacklist.txt");
+    Aliases::loadFromFile(settings_path + "aliases.txt");
 
     Scoreboard scoreboard;
 
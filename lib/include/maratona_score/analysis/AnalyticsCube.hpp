@@ -0,0 +1,133 @@
+//    Copyright 2025 MaratonaCIn
+//
+//    Licensed under the Apache License, Version 2.0 (the "License");
+//    you may not use this file except in compliance with the License.
+//    You may obtain a copy of the License at
+//
+//        http://www.apache.org/licenses/LICENSE-2.0
+//
+//    Unless required by applicable law or agreed to in writing, software
+//    distributed under the License is distributed on an "AS IS" BASIS,
+//    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//    See the License for the specific language governing permissions and
+//    limitations under the License.
+
+#ifndef MSCR_ANALYSIS_ANALYTICSCUBE_HPP
+#define MSCR_ANALYSIS_ANALYTICSCUBE_HPP
+
+#include <array>
+#include <cstdint>
+#include <optional>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include "maratona_score/export.hpp"
+#include "maratona_score/models/Contest.hpp"
+
+namespace MaratonaScore {
+
+// Aggregate kept at every level of the contest x problem x contestant cube.
+// "opportunities" counts (contestant, problem) pairs in scope where the
+// contestant took part in the contest, so rates stay comparable between
+// roll-up levels.
+struct MARATONASCORE_API CubeAggregate {
+    static constexpr int ATTEMPT_BUCKETS = 9;  // 0..7 wrong tries, then 8+
+
+    long long opportunities = 0;
+    long long attempted = 0;  // touched but never accepted
+    long long solved = 0;
+    long long upsolved = 0;
+    int firstSolveTime = -1;
+    long long wrongBeforeAC = 0;
+    long long upsolveLatency = 0;
+    std::array<long long, ATTEMPT_BUCKETS> attemptsHistogram{};
+
+    double solveRate() const;
+    double upsolveRate() const;
+    double meanAttemptsBeforeAC() const;
+    double meanUpsolveLatency() const;
+
+    void merge(const CubeAggregate& other);
+};
+
+// Optional coordinates of a cube slice. Unset coordinates are rolled up.
+struct MARATONASCORE_API CubeSlice {
+    std::optional<std::string> contest;
+    std::optional<std::string> problem;
+    std::optional<std::string> contestant;
+    std::optional<CONTEST_TYPE> type;
+};
+
+class MARATONASCORE_API AnalyticsCube {
+   public:
+    AnalyticsCube() = default;
+    explicit AnalyticsCube(const std::vector<Contest>& contests);
+
+    void build(const std::vector<Contest>& contests);
+
+    const std::vector<std::string>& getContestIds() const;
+    const std::vector<std::string>& getProblemIds(const std::string& contestId) const;
+    const std::vector<std::string>& getContestantIds() const;
+
+    const CubeAggregate& total() const;
+    const CubeAggregate& contest(const std::string& contestId) const;
+    const CubeAggregate& problem(const std::string& contestId,
+                                 const std::string& problemId) const;
+    const CubeAggregate& contestant(const std::string& teamID) const;
+    CubeAggregate contestantInContest(const std::string& teamID,
+                                      const std::string& contestId) const;
+    CubeAggregate slice(const CubeSlice& s) const;
+
+    CONTEST_TYPE getContestType(const std::string& contestId) const;
+    int getParticipants(const std::string& contestId) const;
+    const std::string& getFirstSolver(const std::string& contestId,
+                                      const std::string& problemId) const;
+
+   private:
+    struct ContestInfo {
+        CONTEST_TYPE type;
+        int participants = 0;
+        uint32_t problemOffset = 0;
+        size_t factBegin = 0;
+        size_t factEnd = 0;
+        std::vector<std::string> problems;
+    };
+
+    // Per-(contest, contestant) roll-up, stored contestant-major (CSR).
+    struct Participation {
+        uint16_t contest;
+        uint32_t contestant;
+        CubeAggregate agg;
+    };
+
+    std::vector<ContestInfo> contests;
+    std::vector<std::string> contestIds;
+    std::vector<std::string> contestantIds;
+    std::unordered_map<std::string, uint32_t> contestIndex;
+    std::unordered_map<std::string, uint32_t> contestantIndex;
+
+    // Fact columns: one entry per non-empty problem cell.
+    std::vector<uint16_t> cellContest;
+    std::vector<uint16_t> cellProblem;
+    std::vector<uint32_t> cellContestant;
+    std::vector<uint8_t> cellStatus;
+    std::vector<int32_t> cellTime;
+    std::vector<int32_t> cellAttempts;
+
+    std::vector<CubeAggregate> problemAgg;
+    std::vector<uint32_t> firstSolver;
+    std::vector<CubeAggregate> contestAgg;
+    std::vector<CubeAggregate> contestantAgg;
+    std::vector<Participation> participations;
+    std::vector<uint32_t> participationOffset;
+    CubeAggregate totalAgg;
+
+    uint32_t contestIdx(const std::string& contestId) const;
+    uint32_t problemIdx(uint32_t contest, const std::string& problemId) const;
+    uint32_t contestantIdx(const std::string& teamID) const;
+};  // class AnalyticsCube
+
+}  // namespace MaratonaScore
+
+#endif  // MSCR_ANALYSIS_ANALYTICSCUBE_HPP
@@ -0,0 +1,103 @@
+//    Copyright 2025 MaratonaCIn
+//
+//    Licensed under the Apache License, Version 2.0 (the "License");
+//    you may not use this file except in compliance with the License.
+//    You may obtain a copy of the License at
+//
+//        http://www.apache.org/licenses/LICENSE-2.0
+//
+//    Unless required by applicable law or agreed to in writing, software
+//    distributed under the License is distributed on an "AS IS" BASIS,
+//    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//    See the License for the specific language governing permissions and
+//    limitations under the License.
+
+
+#ifndef MSCR_ANALYSIS_DUPLICATEDETECTOR_HPP
+#define MSCR_ANALYSIS_DUPLICATEDETECTOR_HPP
+
+#include <cstdint>
+#include <ostream>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include "maratona_score/export.hpp"
+#include "maratona_score/models/Contest.hpp"
+
+namespace MaratonaScore {
+
+struct DuplicateOptions {
+    int toleranceMinutes = 5;  // two solves closer than this "coincide"
+    int bands = 20;            // signature length is bands * rows
+    int rows = 4;
+    double threshold = 0.6;    // minimum similarity of a reported pair
+    int minSolves = 4;         // contestants with fewer solves are skipped
+    size_t maxBucket = 500;    // larger LSH buckets are not expanded
+};
+
+// One problem both accounts solved at (nearly) the same minute.
+struct DuplicateEvidence {
+    std::string contestId;
+    std::string problem;
+    int timeA;
+    int timeB;
+    int attemptsA;
+    int attemptsB;
+};
+
+struct DuplicatePair {
+    std::string teamA;
+    std::string teamB;
+    double similarity;  // coinciding solves / solves of either account
+    int solvesA;
+    int solvesB;
+    std::vector<DuplicateEvidence> evidence;
+};
+
+struct DuplicateReport {
+    std::vector<DuplicatePair> pairs;  // most similar first
+    size_t contestants = 0;            // with at least minSolves solves
+    size_t candidates = 0;             // pairs that shared an LSH bucket
+    size_t skippedBuckets = 0;         // buckets larger than maxBucket
+};
+
+// Flags pairs of accounts whose solve timelines (which problems, and at
+// which minute, across the whole season) are suspiciously alike. Each
+// timeline becomes a set of "round:problem:time bucket" tokens, summarized
+// by a MinHash signature; banding the signatures puts similar timelines in
+// a shared bucket, so only those pairs are compared instead of all n².
+// Candidates are then verified exactly on solve times, and the coinciding
+// solves are kept as evidence.
+class MARATONASCORE_API DuplicateDetector {
+   public:
+    explicit DuplicateDetector(DuplicateOptions options = {});
+
+    void addContest(const Contest& contest);
+
+    DuplicateReport detect() const;
+
+    // One line per pair; evidence as "round/problem@timeA~timeB" items.
+    static void renderCSV(std::ostream& os, const DuplicateReport& report);
+
+   private:
+    struct Solve {
+        uint32_t round;
+        std::string problem;
+        int time;
+        int attempts;
+    };
+
+    DuplicateOptions options;
+    std::vector<std::string> rounds;
+    std::vector<std::string> teams;
+    std::vector<std::vector<Solve>> solves;  // by team, in (round, problem) order
+    std::unordered_map<std::string, uint32_t> teamIndex;
+
+    std::vector<uint64_t> signature(const std::vector<Solve>& timeline) const;
+    bool verify(uint32_t a, uint32_t b, DuplicatePair& pair) const;
+};
+
+}  // namespace MaratonaScore
+
+#endif  // MSCR_ANALYSIS_DUPLICATEDETECTOR_HPP
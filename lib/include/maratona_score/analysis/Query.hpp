@@ -0,0 +1,104 @@
+//    Copyright 2025 MaratonaCIn
+//
+//    Licensed under the Apache License, Version 2.0 (the "License");
+//    you may not use this file except in compliance with the License.
+//    You may obtain a copy of the License at
+//
+//        http://www.apache.org/licenses/LICENSE-2.0
+//
+//    Unless required by applicable law or agreed to in writing, software
+//    distributed under the License is distributed on an "AS IS" BASIS,
+//    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//    See the License for the specific language governing permissions and
+//    limitations under the License.
+
+#ifndef MSCR_ANALYSIS_QUERY_HPP
+#define MSCR_ANALYSIS_QUERY_HPP
+
+#include <cstdint>
+#include <memory>
+#include <ostream>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include "maratona_score/export.hpp"
+#include "maratona_score/models/Contest.hpp"
+
+namespace MaratonaScore {
+
+// One row per (season, round, contestant) with the columns
+//   season, contest, type, team             (text)
+//   rank, solved, attempted, upsolved,
+//   penalty, bonus                          (numbers)
+// stored column by column; text columns are dictionary-encoded.
+class MARATONASCORE_API QueryTable {
+   public:
+    struct Column {
+        std::string name;
+        bool text = false;
+        std::vector<double> numbers;
+        std::vector<uint32_t> codes;  // into dictionary
+        std::vector<std::string> dictionary;
+        std::unordered_map<std::string, uint32_t> lookup;
+
+        void addText(const std::string& value);
+    };
+
+    QueryTable();
+
+    void addSeason(const std::string& season,
+                   const std::vector<Contest>& contests);
+
+    size_t size() const;
+    const std::vector<Column>& getColumns() const;
+
+   private:
+    std::vector<Column> columns;
+    size_t rows = 0;
+};
+
+struct MARATONASCORE_API QueryResult {
+    std::vector<std::string> columns;
+    std::vector<std::vector<std::string>> rows;
+
+    void renderCSV(std::ostream& os) const;
+};
+
+// A small pipeline language over a QueryTable; every clause is optional but
+// they must come in this order:
+//
+//   where <condition>
+//   group by <column>, ...
+//   having <condition>
+//   select <column | aggregate>, ...
+//   sort by <column | aggregate> [asc | desc], ...
+//   limit <n>
+//
+// Conditions compare a column (or, after grouping, an aggregate) with a
+// number or a quoted string and combine with and / or / not / ( ). The
+// aggregates are count(), count(<condition>), any(<condition>),
+// all(<condition>), sum/min/max/avg(<column>) and distinct(<column>).
+// Without group by, aggregates fold the whole selection into one row.
+//
+// Conditions are compiled into comparisons over whole column blocks (text
+// comparisons are decided once per dictionary entry), so a query costs a
+// few tight passes over the table rather than a walk through the models.
+class MARATONASCORE_API Query {
+   public:
+    // Throws std::invalid_argument on syntax errors.
+    static Query parse(const std::string& text);
+
+    // Throws std::invalid_argument on unknown columns or mistyped
+    // comparisons.
+    QueryResult run(const QueryTable& table) const;
+
+    struct Plan;
+
+   private:
+    std::shared_ptr<const Plan> plan;
+};
+
+}  // namespace MaratonaScore
+
+#endif  // MSCR_ANALYSIS_QUERY_HPP
@@ -0,0 +1,76 @@
+//    Copyright 2025 MaratonaCIn
+//
+//    Licensed under the Apache License, Version 2.0 (the "License");
+//    you may not use this file except in compliance with the License.
+//    You may obtain a copy of the License at
+//
+//        http://www.apache.org/licenses/LICENSE-2.0
+//
+//    Unless required by applicable law or agreed to in writing, software
+//    distributed under the License is distributed on an "AS IS" BASIS,
+//    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//    See the License for the specific language governing permissions and
+//    limitations under the License.
+
+
+#ifndef MSCR_ANALYSIS_RANKTRAJECTORY_HPP
+#define MSCR_ANALYSIS_RANKTRAJECTORY_HPP
+
+#include <cstdint>
+#include <ostream>
+#include <string>
+#include <vector>
+
+#include "maratona_score/export.hpp"
+#include "maratona_score/models/Contest.hpp"
+#include "maratona_score/models/StreamingScoreboard.hpp"
+#include "maratona_score/score/FixedPoint.hpp"
+
+namespace MaratonaScore {
+
+// Overall score and rank of every contestant after each round, folded in a
+// single pass over the season. Two standings are kept: the raw cumulative
+// one, and the drop-worst-adjusted one (what the scoreboard would say if the
+// season ended now; after the last round it matches scoreboard.csv). A round
+// only changes the scores of its participants, so each step re-sorts just
+// those and merges them back into the previous order: O(n + k log k) for k
+// participants instead of a full sort.
+class MARATONASCORE_API RankTrajectory {
+   public:
+    // Rounds must be added in season order.
+    void addContest(const Contest& contest, int index);
+
+    int getStep() const;
+    const std::string& getContestId() const;
+
+    size_t size() const;
+    const std::string& getTeamID(uint32_t row) const;
+    ScoreValue getScore(uint32_t row, bool adjusted) const;
+    int getRank(uint32_t row, bool adjusted) const;  // 0 if blacklisted
+
+    // Ranked contestants after the current step.
+    const std::vector<uint32_t>& getRanking(bool adjusted) const;
+
+    // Long format: one line per contestant and step, in raw rank order.
+    static void renderHeader(std::ostream& os);
+    void renderStep(std::ostream& os) const;
+
+   private:
+    struct Standing {
+        std::vector<ScoreValue> scores;  // by row
+        std::vector<int> ranks;
+        std::vector<uint32_t> order;
+    };
+
+    StreamingScoreboard board;
+    Standing raw;
+    Standing adjusted;
+    int step = 0;
+    std::string contestId;
+
+    void rerank(Standing& standing, std::vector<uint32_t>& changed);
+};
+
+}  // namespace MaratonaScore
+
+#endif  // MSCR_ANALYSIS_RANKTRAJECTORY_HPP
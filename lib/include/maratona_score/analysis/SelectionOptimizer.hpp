@@ -0,0 +1,103 @@
+//    Copyright 2025 MaratonaCIn
+//
+//    Licensed under the Apache License, Version 2.0 (the "License");
+//    you may not use this file except in compliance with the License.
+//    You may obtain a copy of the License at
+//
+//        http://www.apache.org/licenses/LICENSE-2.0
+//
+//    Unless required by applicable law or agreed to in writing, software
+//    distributed under the License is distributed on an "AS IS" BASIS,
+//    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//    See the License for the specific language governing permissions and
+//    limitations under the License.
+
+
+#ifndef MSCR_ANALYSIS_SELECTIONOPTIMIZER_HPP
+#define MSCR_ANALYSIS_SELECTIONOPTIMIZER_HPP
+
+#include <cstdint>
+#include <ostream>
+#include <string>
+#include <vector>
+
+#include "maratona_score/export.hpp"
+#include "maratona_score/models/Scoreboard.hpp"
+#include "maratona_score/score/FixedPoint.hpp"
+
+namespace MaratonaScore {
+
+struct MARATONASCORE_API SelectionGroup {
+    std::string name;
+    std::vector<std::string> members;
+    int min = 0;
+    int max = -1;  // -1 = no limit
+};
+
+// Declarative constraints for picking the selected teams, read from YAML:
+//
+//   selection:
+//     size: 10
+//     min_contests: 6      # rounds the team must have played
+//     min_homeworks: 4
+//     required: [team]     # always selected
+//     excluded: [team]     # never selected
+//     groups:
+//       - name: class-2023
+//         members: [a, b, c]
+//         max: 3
+//       - name: freshmen
+//         members: [d, e]
+//         min: 1
+struct MARATONASCORE_API SelectionConstraints {
+    int size = 10;
+    int minContests = 0;
+    int minHomeworks = 0;
+    std::vector<std::string> required;
+    std::vector<std::string> excluded;
+    std::vector<SelectionGroup> groups;
+
+    static SelectionConstraints loadFromFile(const std::string& filename);
+};
+
+struct MARATONASCORE_API SelectedTeam {
+    std::string teamID;
+    int rank;  // overall rank
+    ScoreValue score;
+};
+
+struct MARATONASCORE_API SelectionResult {
+    bool feasible = false;
+    ScoreValue totalScore = 0;
+    uint64_t nodes = 0;                 // search nodes visited
+    std::vector<SelectedTeam> selected;  // ranking order
+};
+
+// Exact best selection (maximum total overall score) under the constraints.
+// Branch-and-bound over the eligible contestants in ranking order: the bound
+// of a branch is its score plus the best scores still available, so once the
+// incumbent beats it no later branch can do better and the loop stops. Ties
+// keep the selection that is first in ranking order.
+class MARATONASCORE_API SelectionOptimizer {
+   public:
+    explicit SelectionOptimizer(const Scoreboard& scoreboard);
+
+    SelectionResult solve(const SelectionConstraints& constraints) const;
+
+    static void renderCSV(std::ostream& os, const SelectionResult& result);
+
+   private:
+    struct Candidate {
+        std::string teamID;
+        int rank;
+        ScoreValue score;
+        int contests;
+        int homeworks;
+    };
+
+    std::vector<Candidate> candidates;  // ranking order
+};
+
+}  // namespace MaratonaScore
+
+#endif  // MSCR_ANALYSIS_SELECTIONOPTIMIZER_HPP
@@ -0,0 +1,92 @@
+//    Copyright 2025 MaratonaCIn
+//
+//    Licensed under the Apache License, Version 2.0 (the "License");
+//    you may not use this file except in compliance with the License.
+//    You may obtain a copy of the License at
+//
+//        http://www.apache.org/licenses/LICENSE-2.0
+//
+//    Unless required by applicable law or agreed to in writing, software
+//    distributed under the License is distributed on an "AS IS" BASIS,
+//    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//    See the License for the specific language governing permissions and
+//    limitations under the License.
+
+#ifndef MSCR_ANALYSIS_SELECTIONSIMULATOR_HPP
+#define MSCR_ANALYSIS_SELECTIONSIMULATOR_HPP
+
+#include <cstdint>
+#include <ostream>
+#include <string>
+#include <vector>
+
+#include "maratona_score/export.hpp"
+#include "maratona_score/models/Scoreboard.hpp"
+
+namespace MaratonaScore {
+
+struct MARATONASCORE_API SimulationOptions {
+    int iterations = 200000;
+    int selectionSize = 10;
+    int threads = 0;  // 0 = one per hardware thread
+    int rankBuckets = 50;
+    bool includeFinals = true;
+    uint64_t seed = 0x4d61726174;
+};
+
+struct MARATONASCORE_API ContestantProjection {
+    std::string teamID;
+    double currentScore;
+    double meanScore;
+    double selectionProbability;
+    double meanRank;
+    // P(final rank == r + 1) for r < rankBuckets - 1; the last bucket holds
+    // every rank beyond that.
+    std::vector<double> rankDistribution;
+};
+
+// Monte Carlo projection of the final standings from a partially played
+// season. Every remaining contest and homework (and the finals, if enabled)
+// is drawn from the contestant's own past rounds, rescaled to the weight of
+// the round being simulated, and the drop-worst rule is applied before
+// ranking. Scoreboard data is flattened once into arrays; each worker thread
+// runs its share of the iterations with its own RNG stream.
+class MARATONASCORE_API SelectionSimulator {
+   public:
+    explicit SelectionSimulator(const Scoreboard& scoreboard);
+
+    std::vector<ContestantProjection> simulate(
+        const SimulationOptions& options) const;
+
+    static void renderCSV(std::ostream& os,
+                          const std::vector<ContestantProjection>& projections);
+
+   private:
+    struct Sample {
+        double normalizedSolve;
+        double bonus;
+        double upsolve;
+    };
+
+    int contestSlots = 0;
+    int dropWorst = 0;
+    bool finalsPlayed = false;
+
+    std::vector<std::string> teamIDs;
+    std::vector<double> currentScores;
+    std::vector<double> fixedScores;        // homework, upsolves, finals
+    std::vector<double> playedSlots;        // contestants x contestSlots
+    std::vector<int> remainingContests;
+    std::vector<int> remainingHomeworks;
+    std::vector<double> contestWeights;     // per slot, plus finals at the end
+    std::vector<double> homeworkWeights;
+
+    std::vector<Sample> contestSamples;     // CSR by contestant
+    std::vector<uint32_t> contestSampleOffset;
+    std::vector<Sample> homeworkSamples;
+    std::vector<uint32_t> homeworkSampleOffset;
+};
+
+}  // namespace MaratonaScore
+
+#endif  // MSCR_ANALYSIS_SELECTIONSIMULATOR_HPP
@@ -0,0 +1,94 @@
+//    Copyright 2025 MaratonaCIn
+//
+//    Licensed under the Apache License, Version 2.0 (the "License");
+//    you may not use this file except in compliance with the License.
+//    You may obtain a copy of the License at
+//
+//        http://www.apache.org/licenses/LICENSE-2.0
+//
+//    Unless required by applicable law or agreed to in writing, software
+//    distributed under the License is distributed on an "AS IS" BASIS,
+//    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//    See the License for the specific language governing permissions and
+//    limitations under the License.
+
+
+#ifndef MSCR_ANALYSIS_STANDINGSINDEX_HPP
+#define MSCR_ANALYSIS_STANDINGSINDEX_HPP
+
+#include <cstdint>
+#include <ostream>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include "maratona_score/export.hpp"
+#include "maratona_score/models/Contest.hpp"
+#include "maratona_score/models/Scoreboard.hpp"
+#include "maratona_score/score/FixedPoint.hpp"
+
+namespace MaratonaScore {
+
+// What a single remaining round would have to yield on its own.
+struct MARATONASCORE_API RoundRequirement {
+    std::string round;        // "7", "H7" or "FINALS"
+    CONTEST_TYPE type;
+    ScoreValue problemValue;  // flat value of one problem in that round
+    ScoreValue roundScore;    // solve + bonus needed in that round
+    int problems;             // at problemValue without rank bonus, -1 if
+                              // the round is worth nothing
+};
+
+struct MARATONASCORE_API Requirement {
+    std::string teamID;
+    int currentRank;
+    int targetRank;
+    ScoreValue currentScore;
+    ScoreValue additionalScore;  // 0 when already at or above targetRank
+    std::vector<RoundRequirement> rounds;
+};
+
+// Sorted totals of a scoreboard plus, per contestant, the smallest contest
+// total that still survives drop-worst. With other contestants standing
+// still, a remaining contest scoring s adds max(0, s - threshold) to the
+// total, while homeworks and the finals are never dropped.
+//
+// Lookups are O(1) by rank and O(log n) by score, so the index can be built
+// once per publish and queried for every contestant.
+class MARATONASCORE_API StandingsIndex {
+   public:
+    explicit StandingsIndex(const Scoreboard& scoreboard);
+
+    size_t size() const;
+    int rankOf(const std::string& teamID) const;
+
+    // Rank teamID would have with `total`, everybody else unchanged.
+    int rankWith(const std::string& teamID, ScoreValue total) const;
+
+    ScoreValue requiredScore(const std::string& teamID, int targetRank) const;
+    Requirement query(const std::string& teamID, int targetRank) const;
+    std::vector<Requirement> queryAll(int targetRank) const;
+
+    static void renderCSV(std::ostream& os,
+                          const std::vector<Requirement>& requirements);
+
+   private:
+    struct Round {
+        std::string id;
+        CONTEST_TYPE type;
+        ScoreValue problemValue;
+        bool dropped;  // subject to drop-worst
+    };
+
+    std::vector<std::string> teamIDs;    // ranking order
+    std::vector<ScoreValue> totals;      // ranking order, descending
+    std::vector<ScoreValue> thresholds;  // smallest kept contest total
+    std::unordered_map<std::string, uint32_t> positions;
+    std::vector<Round> remaining;
+
+    uint32_t positionOf(const std::string& teamID) const;
+};
+
+}  // namespace MaratonaScore
+
+#endif  // MSCR_ANALYSIS_STANDINGSINDEX_HPP
@@ -17,6 +17,7 @@
 
 #include <map>
 #include <string>
+#include <vector>
 
 #include "maratona_score/export.hpp"
 #include "maratona_score/models/Performance.hpp"
@@ -25,6 +26,19 @@ namespace MaratonaScore {
 
 enum CONTEST_TYPE { CONTEST, HOMEWORK };
 
+enum REJUDGE_VERDICT { REJUDGE_ACCEPTED, REJUDGE_REJECTED, REJUDGE_CLEAR };
+
+// One rejudged problem cell, e.g. contest 3, team X, problem D accepted at
+// 83 minutes after 2 wrong tries.
+struct MARATONASCORE_API RejudgePatch {
+    std::string contestId;
+    std::string teamID;
+    std::string problemId;
+    REJUDGE_VERDICT verdict;
+    int time = 0;   // minutes, accepted only
+    int tries = 0;  // wrong tries
+};
+
 class MARATONASCORE_API Contest {
    public:
     Contest();
@@ -41,10 +55,21 @@ class MARATONASCORE_API Contest {
     void setType(CONTEST_TYPE contestType);
     void addPerformance(const std::string& teamID, const Performance& perf);
 
+    // Updates one cell and moves the team to its new place, re-ranking and
+    // re-awarding bonuses only between its old and new positions. A team not
+    // in the round is added at the bottom first; a blacklisted team is left
+    // out. Returns the teams whose performance changed, in rank order.
+    std::vector<std::string> applyPatch(const RejudgePatch& patch);
+
    private:
     std::string id;
     CONTEST_TYPE type;
     std::map<std::string, Performance> performances;
+
+    // Team IDs in rank order, built on the first patch.
+    std::vector<std::string> standings;
+
+    bool ranksBefore(const std::string& a, const std::string& b) const;
 };  // class Contest
 
 }  // namespace MaratonaScore
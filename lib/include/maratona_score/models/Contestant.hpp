@@ -17,9 +17,12 @@
 
 #include <map>
 #include <string>
+#include <vector>
 
 #include "maratona_score/export.hpp"
+#include "maratona_score/models/Contest.hpp"
 #include "maratona_score/models/Performance.hpp"
+#include "maratona_score/score/FixedPoint.hpp"
 
 namespace MaratonaScore {
 
@@ -27,36 +30,44 @@ class MARATONASCORE_API Contestant {
     friend class Scoreboard;
 
    public:
-    void addScoreContest(double s);
-    void addScoreHomework(double s);
-    void addScoreUpsolved(double s);
-    void addScoreBonus(double s);
+    struct ContestScore {
+        ScoreValue solve;
+        ScoreValue bonus;
+        ScoreValue upsolve;
+        ScoreValue total() const;
+
+        // Kept for Scoreboard::explain; weights are recomputed from these.
+        int index = 0;
+        CONTEST_TYPE type = CONTEST;
+        int solved = 0;
+        int upsolved = 0;
+    };
+
+    void addScoreContest(ScoreValue s);
+    void addScoreHomework(ScoreValue s);
+    void addScoreUpsolved(ScoreValue s);
+    void addScoreBonus(ScoreValue s);
 
     double getScoreContest() const;
     double getScoreHomework() const;
     double getScoreUpsolved() const;
     double getScoreBonus() const;
     double getTotalScore() const;
+    ScoreValue getTotalScoreFixed() const;
+    const std::map<std::string, ContestScore>& getContestScores() const;
 
    protected:
-    std::map<std::string, Performance*> ContestsPerformance;
-
-    struct ContestScore {
-        double solve;
-        double bonus;
-        double total() const;
-    };
-
     std::map<std::string, ContestScore> contestScores;
+    std::vector<std::string> droppedContests;
 
    private:
     std::string id;
     std::string name;
-    double score = 0.0;
-    double scoreContest = 0.0;
-    double scoreHomework = 0.0;
-    double scoreUpsolved = 0.0;
-    double scoreBonus = 0.0;
+    ScoreValue score = 0;
+    ScoreValue scoreContest = 0;
+    ScoreValue scoreHomework = 0;
+    ScoreValue scoreUpsolved = 0;
+    ScoreValue scoreBonus = 0;
     double totalProblemsSolved = 0.0;
     double problemsSolved = 0.0;
     double problemsUpsolved = 0.0;
@@ -19,6 +19,7 @@
 #include <string>
 
 #include "maratona_score/export.hpp"
+#include "maratona_score/score/FixedPoint.hpp"
 
 namespace MaratonaScore {
 
@@ -56,13 +57,17 @@ class MARATONASCORE_API Performance {
     int getProblemsSolved() const;
     int getProblemsAttempted() const;
     int getProblemsUpsolved() const;
-    double getBonusScore() const;
+    ScoreValue getBonusScore() const;
     const std::map<std::string, ProblemStatus>& getProblems() const;
 
     void setRank(int r);
     void setPenalty(int p);
-    void setBonusScore(double bonus);
+    void setBonusScore(ScoreValue bonus);
     void addProblem(const std::string& problemId, const ProblemStatus& status);
+    // Replaces a problem cell (NOT_ATTEMPTED removes it), keeping the
+    // counters and the ICPC penalty (time + 20 per wrong try) in sync.
+    void updateProblem(const std::string& problemId,
+                       const ProblemStatus& status);
     void setProblemsUpsolved(int ups);
 
     bool operator<(const Performance& other) const;
@@ -73,7 +78,7 @@ class MARATONASCORE_API Performance {
     int problems_solved;
     int problems_attempted;
     int problems_upsolved;
-    double bonus_score;
+    ScoreValue bonus_score;
 
     std::map<std::string, ProblemStatus> problems;
 };  // class Performance
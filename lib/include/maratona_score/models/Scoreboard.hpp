@@ -18,25 +18,89 @@
 #include <map>
 #include <ostream>
 #include <string>
+#include <utility>
+#include <vector>
 
 #include "maratona_score/export.hpp"
 #include "maratona_score/models/Contest.hpp"
 #include "maratona_score/models/Contestant.hpp"
+#include "maratona_score/score/RatingEngine.hpp"
 namespace MaratonaScore {
 
+struct ContestTally;  // score/ScoringPolicy.hpp
+
+struct MARATONASCORE_API ContestBreakdown {
+    std::string contestId;
+    CONTEST_TYPE type;
+    int index;
+    ScoreValue problemValue;  // weighted flat value of one problem
+    int solved;
+    int upsolved;
+    ScoreValue solve;
+    ScoreValue upsolve;
+    ScoreValue bonus;
+    bool dropped;  // solve and bonus left out by drop-worst
+};
+
+struct MARATONASCORE_API Explanation {
+    std::string teamID;
+    std::vector<ContestBreakdown> contests;  // in season order
+    ScoreValue contestScore;
+    ScoreValue homeworkScore;
+    ScoreValue upsolvedScore;
+    ScoreValue bonusScore;
+    ScoreValue totalScore;
+};
+
 class MARATONASCORE_API Scoreboard {
    public:
     Scoreboard() = default;
     ~Scoreboard() = default;
 
     void addContest(const Contest& contest, int index);
+    // Folds part of a round (e.g. one shard's contestants) using problem
+    // values from the tally of the whole round. Ratings are not updated.
+    void addContest(const Contest& contest, int index,
+                    const ContestTally& tally);
     void applyContestFiltering();
+
+    // Patches `contest` (the same object passed to addContest with `index`)
+    // and moves the score deltas of every re-ranked team into the totals,
+    // re-applying drop-worst to them. Ratings are not replayed.
+    void applyRejudge(Contest& contest, int index, const RejudgePatch& patch);
     friend std::ostream& operator<<(std::ostream& os, const Scoreboard& sb);
 
     void renderCSV(std::ostream& os) const;
+    static void renderCSVHeader(std::ostream& os, bool rated);
+
+    // The renderCSV rows (no header, no ratings) in ranking order, each
+    // prefixed by "<fixed-point total>\t<team ID>\t": a sorted run that
+    // mergeShardRuns can merge with the runs of other shards.
+    void renderRun(std::ostream& os) const;
+
+    const std::map<std::string, Contestant>& getContestants() const;
+    std::vector<std::pair<std::string, const Contestant*>> getRanking() const;
+
+    // Per-contest breakdown of a contestant's total, rebuilt from the
+    // contest scores kept by addContest. Throws std::out_of_range for
+    // unknown contestants.
+    Explanation explain(const std::string& teamID) const;
+
+    // Updated by addContest when rating.enabled is set in config.yaml.
+    RatingEngine& getRatings();
+    const RatingEngine& getRatings() const;
 
    protected:
     std::map<std::string, Contestant> contestants;
+    RatingEngine ratings;
+    bool filtered = false;
+
+   private:
+    template <typename Scorer>
+    void foldContest(const Contest& contest, int index,
+                     const Scorer& solveScorer);
+    void dropWorstContests(Contestant& contestant);
+    void restoreDroppedContests(Contestant& contestant);
 
 };  // class Scoreboard
 
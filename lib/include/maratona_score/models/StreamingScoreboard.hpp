@@ -0,0 +1,92 @@
+//    Copyright 2025 MaratonaCIn
+//
+//    Licensed under the Apache License, Version 2.0 (the "License");
+//    you may not use this file except in compliance with the License.
+//    You may obtain a copy of the License at
+//
+//        http://www.apache.org/licenses/LICENSE-2.0
+//
+//    Unless required by applicable law or agreed to in writing, software
+//    distributed under the License is distributed on an "AS IS" BASIS,
+//    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//    See the License for the specific language governing permissions and
+//    limitations under the License.
+
+
+#ifndef MSCR_MODELS_STREAMINGSCOREBOARD_HPP
+#define MSCR_MODELS_STREAMINGSCOREBOARD_HPP
+
+#include <cstdint>
+#include <ostream>
+#include <string>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include "maratona_score/export.hpp"
+#include "maratona_score/models/Contest.hpp"
+#include "maratona_score/score/RatingEngine.hpp"
+#include "maratona_score/score/FixedPoint.hpp"
+
+namespace MaratonaScore {
+
+// Scoreboard variant for very large seasons. Each contest is reduced into one
+// fixed-width row per contestant (solve, bonus, upsolve per round slot) as soon as it
+// is added, so the caller can discard it right away. Memory is bounded by
+// contestants x rounds; the CSV is identical to Scoreboard::renderCSV.
+//
+// Slots are indexed by round: contests 0..N-1, the finals at N, then
+// homeworks 0..N-1 at N+1..2N.
+class MARATONASCORE_API StreamingScoreboard {
+   public:
+    struct Totals {
+        ScoreValue contest = 0;
+        ScoreValue homework = 0;
+        ScoreValue upsolved = 0;
+        ScoreValue bonus = 0;
+        ScoreValue total() const;
+    };
+
+    StreamingScoreboard();
+
+    void addContest(const Contest& contest, int index);
+    void applyContestFiltering();
+
+    void renderCSV(std::ostream& os) const;
+
+    size_t size() const;
+    const std::string& getTeamID(uint32_t row) const;
+    uint32_t getRow(const std::string& teamID) const;
+    Totals getTotals(uint32_t row) const;
+    // Score applyContestFiltering would remove from this row right now.
+    ScoreValue getDroppedScore(uint32_t row) const;
+    std::vector<uint32_t> getRanking() const;
+
+    RatingEngine& getRatings();
+    const RatingEngine& getRatings() const;
+
+   private:
+    struct Cell {
+        ScoreValue solve;
+        ScoreValue bonus;
+        ScoreValue upsolve;
+    };
+
+    int contests;
+    size_t width;
+
+    std::unordered_map<std::string, uint32_t> rows;
+    std::vector<std::string> teamIDs;
+    std::vector<Cell> cells;
+    RatingEngine ratings;
+
+    uint32_t intern(const std::string& teamID);
+    size_t slotOf(CONTEST_TYPE type, int index) const;
+    // Contest slots by (solve + bonus), worst first; returns how many drop.
+    int worstContests(uint32_t row,
+                      std::vector<std::pair<ScoreValue, int>>& totals) const;
+};
+
+}  // namespace MaratonaScore
+
+#endif  // MSCR_MODELS_STREAMINGSCOREBOARD_HPP
@@ -0,0 +1,87 @@
+//    Copyright 2025 MaratonaCIn
+//
+//    Licensed under the Apache License, Version 2.0 (the "License");
+//    you may not use this file except in compliance with the License.
+//    You may obtain a copy of the License at
+//
+//        http://www.apache.org/licenses/LICENSE-2.0
+//
+//    Unless required by applicable law or agreed to in writing, software
+//    distributed under the License is distributed on an "AS IS" BASIS,
+//    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//    See the License for the specific language governing permissions and
+//    limitations under the License.
+
+#ifndef MSCR_OUTPUT_ARROWEXPORT_HPP
+#define MSCR_OUTPUT_ARROWEXPORT_HPP
+
+#include <cstdint>
+
+#include "maratona_score/export.hpp"
+#include "maratona_score/models/Contest.hpp"
+#include "maratona_score/models/Scoreboard.hpp"
+
+// Arrow C Data Interface, copied verbatim from the Arrow specification so
+// consumers (pyarrow, polars, DuckDB, arrow-cpp...) can import the exported
+// arrays without MaratonaScore depending on Arrow.
+#ifndef ARROW_C_DATA_INTERFACE
+#define ARROW_C_DATA_INTERFACE
+
+#define ARROW_FLAG_DICTIONARY_ORDERED 1
+#define ARROW_FLAG_NULLABLE 2
+#define ARROW_FLAG_MAP_KEYS_SORTED 4
+
+extern "C" {
+
+struct ArrowSchema {
+    const char* format;
+    const char* name;
+    const char* metadata;
+    int64_t flags;
+    int64_t n_children;
+    struct ArrowSchema** children;
+    struct ArrowSchema* dictionary;
+
+    void (*release)(struct ArrowSchema*);
+    void* private_data;
+};
+
+struct ArrowArray {
+    int64_t length;
+    int64_t null_count;
+    int64_t offset;
+    int64_t n_buffers;
+    int64_t n_children;
+    const void** buffers;
+    struct ArrowArray** children;
+    struct ArrowArray* dictionary;
+
+    void (*release)(struct ArrowArray*);
+    void* private_data;
+};
+
+}  // extern "C"
+
+#endif  // ARROW_C_DATA_INTERFACE
+
+namespace MaratonaScore {
+
+// Both functions fill caller-allocated structs with a struct array (one row
+// per contestant/performance). Ownership of the buffers moves to the caller,
+// who must call the release callbacks once done.
+//
+// Scoreboard columns: rank, team_id, contest_score, homework_score,
+// upsolved_score, bonus_score, total_score, rating (only when the rating
+// track is enabled), then "<contest>.solve",
+// "<contest>.bonus" and "<contest>.upsolve" for every contest seen (null
+// where the contestant did not take part). Rows follow the final ranking.
+MARATONASCORE_API void exportScoreboard(const Scoreboard& scoreboard,
+                                        ArrowSchema* schema, ArrowArray* array);
+
+// Contest columns: rank, team_id, penalty, solved, attempted, upsolved, bonus.
+MARATONASCORE_API void exportContest(const Contest& contest,
+                                     ArrowSchema* schema, ArrowArray* array);
+
+}  // namespace MaratonaScore
+
+#endif  // MSCR_OUTPUT_ARROWEXPORT_HPP
@@ -0,0 +1,162 @@
+//    Copyright 2025 MaratonaCIn
+//
+//    Licensed under the Apache License, Version 2.0 (the "License");
+//    you may not use this file except in compliance with the License.
+//    You may obtain a copy of the License at
+//
+//        http://www.apache.org/licenses/LICENSE-2.0
+//
+//    Unless required by applicable law or agreed to in writing, software
+//    distributed under the License is distributed on an "AS IS" BASIS,
+//    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//    See the License for the specific language governing permissions and
+//    limitations under the License.
+
+
+#ifndef MSCR_OUTPUT_SHAREDSCOREBOARD_HPP
+#define MSCR_OUTPUT_SHAREDSCOREBOARD_HPP
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <string_view>
+
+#include "maratona_score/export.hpp"
+#include "maratona_score/output/StandingsDelta.hpp"
+
+namespace MaratonaScore {
+
+// Layout of a published scoreboard segment. Everything is little-endian and
+// fixed-width so other languages can read it directly:
+//
+//   SharedHeader | SharedRow[rowCount] | team IDs (UTF-8, not terminated)
+//
+// `sequence` is a seqlock: it is odd while a snapshot is being written and
+// grows by two per publication, so generation = sequence / 2. The segment
+// only ever grows; readers remap when segmentSize changes.
+constexpr char SHARED_MAGIC[8] = {'M', 'S', 'C', 'R', 'S', 'H', 'M', '\0'};
+constexpr uint32_t SHARED_LAYOUT_VERSION = 1;
+
+struct SharedHeader {
+    char magic[8];
+    uint32_t layoutVersion;
+    uint32_t headerSize;
+    uint64_t sequence;
+    uint64_t segmentSize;
+    int64_t scoreScale;  // fixed-point scores are value / scoreScale
+    uint32_t rowSize;
+    uint32_t rowCount;
+    uint32_t rated;
+    uint32_t reserved;
+    uint64_t rowsOffset;
+    uint64_t stringsOffset;
+    uint64_t stringsSize;
+};
+
+struct SharedRow {
+    int64_t contest;
+    int64_t homework;
+    int64_t upsolved;
+    int64_t bonus;
+    int64_t total;
+    double rating;
+    uint32_t rank;
+    uint32_t teamIDOffset;  // into the strings area
+    uint32_t teamIDLength;
+    uint32_t reserved;
+};
+
+// Rows of one snapshot, read in place. Only valid inside
+// SharedScoreboardReader::read; bounds are checked so that a view of a torn
+// write (which read() then discards) never reads outside the segment.
+class MARATONASCORE_API SharedStandingsView {
+   public:
+    SharedStandingsView(const char* base, size_t size);
+
+    uint32_t size() const;
+    bool isRated() const;
+    const SharedRow& row(uint32_t index) const;
+    std::string_view teamID(uint32_t index) const;
+
+   private:
+    const char* base;
+    const SharedRow* rows = nullptr;
+    const char* strings = nullptr;
+    uint32_t rowCount = 0;
+    uint64_t stringsSize = 0;
+    bool rated = false;
+};
+
+// Writer side: owns the named segment (POSIX shared memory, or a named file
+// mapping on Windows, where it cannot grow past its initial capacity). On
+// macOS a segment grows by being replaced under the same name, and names
+// are limited to 31 characters including the leading '/'.
+class MARATONASCORE_API SharedScoreboard {
+   public:
+    explicit SharedScoreboard(const std::string& name,
+                              size_t capacity = 1 << 20);
+    ~SharedScoreboard();
+
+    SharedScoreboard(const SharedScoreboard&) = delete;
+    SharedScoreboard& operator=(const SharedScoreboard&) = delete;
+
+    // Returns the generation of the published snapshot.
+    uint64_t publish(const StandingsSnapshot& snapshot);
+
+    static void remove(const std::string& name);
+
+   private:
+    std::string name;
+    char* base = nullptr;
+    size_t length = 0;
+#ifdef _WIN32
+    void* mapping = nullptr;
+#else
+    int fd = -1;
+#endif
+
+    void map(size_t size);
+};
+
+class MARATONASCORE_API SharedScoreboardReader {
+   public:
+    explicit SharedScoreboardReader(const std::string& name);
+    ~SharedScoreboardReader();
+
+    SharedScoreboardReader(const SharedScoreboardReader&) = delete;
+    SharedScoreboardReader& operator=(const SharedScoreboardReader&) = delete;
+
+    // Latest published generation (0 before the first publication); cheap
+    // enough to poll.
+    uint64_t generation() const;
+
+    // Calls visit(const SharedStandingsView&) until it has seen a snapshot
+    // that was not overwritten meanwhile, and returns its generation. The
+    // visitor may run more than once, so it should only read.
+    template <typename Visit>
+    uint64_t read(Visit&& visit) {
+        for (;;) {
+            uint64_t sequence = beginRead();
+            visit(SharedStandingsView(base, length));
+            if (endRead(sequence)) return sequence / 2;
+        }
+    }
+
+   private:
+    std::string name;
+    const char* base = nullptr;
+    size_t length = 0;
+#ifdef _WIN32
+    void* mapping = nullptr;
+#else
+    int fd = -1;
+#endif
+
+    void map();
+    uint64_t beginRead();
+    bool endRead(uint64_t sequence) const;
+};
+
+}  // namespace MaratonaScore
+
+#endif  // MSCR_OUTPUT_SHAREDSCOREBOARD_HPP
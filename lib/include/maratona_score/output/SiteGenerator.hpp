@@ -0,0 +1,56 @@
+//    Copyright 2025 MaratonaCIn
+//
+//    Licensed under the Apache License, Version 2.0 (the "License");
+//    you may not use this file except in compliance with the License.
+//    You may obtain a copy of the License at
+//
+//        http://www.apache.org/licenses/LICENSE-2.0
+//
+//    Unless required by applicable law or agreed to in writing, software
+//    distributed under the License is distributed on an "AS IS" BASIS,
+//    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//    See the License for the specific language governing permissions and
+//    limitations under the License.
+
+#ifndef MSCR_OUTPUT_SITEGENERATOR_HPP
+#define MSCR_OUTPUT_SITEGENERATOR_HPP
+
+#include <string>
+#include <vector>
+
+#include "maratona_score/export.hpp"
+#include "maratona_score/models/Contest.hpp"
+#include "maratona_score/models/Scoreboard.hpp"
+
+namespace MaratonaScore {
+
+struct MARATONASCORE_API SiteOptions {
+    std::string title = "MaratonaScore";
+    int threads = 0;    // 0 uses every hardware thread
+    bool gzip = true;   // also write page.html.gz next to every page
+};
+
+struct MARATONASCORE_API SiteReport {
+    int pages = 0;
+    int written = 0;  // pages whose content changed since the last run
+    int removed = 0;  // pages of contestants or contests no longer present
+};
+
+// Static HTML standings: index.html, contestants/<id>.html with the round
+// breakdown and problem cells of every contestant, and contests/<id>.html
+// with the full results of every round. Pages are rendered in parallel and
+// hashed; a manifest in outputDir remembers the hashes, so a re-run only
+// rewrites the pages whose content changed and removes the ones that are
+// gone. Nothing else in outputDir is touched.
+MARATONASCORE_API SiteReport generateSite(const Scoreboard& scoreboard,
+                                          const std::vector<Contest>& contests,
+                                          const std::string& outputDir,
+                                          const SiteOptions& options = {});
+
+// File name used for a team or contest id: ASCII letters, digits, '-' and
+// '_' are kept, every other byte becomes ~XX.
+MARATONASCORE_API std::string pageSlug(const std::string& id);
+
+}  // namespace MaratonaScore
+
+#endif  // MSCR_OUTPUT_SITEGENERATOR_HPP
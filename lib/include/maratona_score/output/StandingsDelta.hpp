@@ -0,0 +1,95 @@
+//    Copyright 2025 MaratonaCIn
+//
+//    Licensed under the Apache License, Version 2.0 (the "License");
+//    you may not use this file except in compliance with the License.
+//    You may obtain a copy of the License at
+//
+//        http://www.apache.org/licenses/LICENSE-2.0
+//
+//    Unless required by applicable law or agreed to in writing, software
+//    distributed under the License is distributed on an "AS IS" BASIS,
+//    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//    See the License for the specific language governing permissions and
+//    limitations under the License.
+
+
+#ifndef MSCR_OUTPUT_STANDINGSDELTA_HPP
+#define MSCR_OUTPUT_STANDINGSDELTA_HPP
+
+#include <ostream>
+#include <string>
+#include <vector>
+
+#include "maratona_score/export.hpp"
+#include "maratona_score/models/Scoreboard.hpp"
+#include "maratona_score/models/StreamingScoreboard.hpp"
+#include "maratona_score/score/FixedPoint.hpp"
+
+namespace MaratonaScore {
+
+// One published scoreboard.csv row, with its rank (1-based row order).
+struct MARATONASCORE_API StandingsRow {
+    std::string teamID;
+    int rank = 0;
+    ScoreValue contest = 0;
+    ScoreValue homework = 0;
+    ScoreValue upsolved = 0;
+    ScoreValue bonus = 0;
+    ScoreValue total = 0;
+    double rating = 0.0;
+
+    bool sameValues(const StandingsRow& other) const;
+};
+
+// The standings as last published. Saved with the fixed-point scores and
+// full-precision ratings, so comparing two snapshots never sees rounding.
+class MARATONASCORE_API StandingsSnapshot {
+   public:
+    static StandingsSnapshot fromScoreboard(const Scoreboard& scoreboard);
+    static StandingsSnapshot fromScoreboard(
+        const StreamingScoreboard& scoreboard);
+
+    static StandingsSnapshot load(const std::string& path);
+    void save(const std::string& path) const;
+
+    bool isRated() const;
+    const std::vector<StandingsRow>& getRows() const;
+
+   private:
+    bool rated = false;
+    std::vector<StandingsRow> rows;  // ranking order
+};
+
+enum DELTA_OP { DELTA_ADDED, DELTA_REMOVED, DELTA_CHANGED, DELTA_MOVED };
+
+struct MARATONASCORE_API DeltaEntry {
+    DELTA_OP op;
+    const StandingsRow* row;       // current row; the old one if removed
+    int previousRank;              // 0 if added
+};
+
+// Rows that differ between two snapshots: new and removed contestants,
+// changed scores, and rank moves with unchanged scores. Team IDs of the
+// previous snapshot are interned once, so the diff is linear in the number
+// of rows. Entries follow the current ranking, then removed rows, and point
+// into the snapshots, which must outlive the delta.
+class MARATONASCORE_API StandingsDelta {
+   public:
+    StandingsDelta(const StandingsSnapshot& previous,
+                   const StandingsSnapshot& current);
+
+    const std::vector<DeltaEntry>& getEntries() const;
+    bool empty() const;
+
+    // Patch for scoreboard.csv: one line per entry, values formatted like the
+    // scoreboard (left empty for removed and moved rows).
+    void renderCSV(std::ostream& os) const;
+
+   private:
+    bool rated;
+    std::vector<DeltaEntry> entries;
+};
+
+}  // namespace MaratonaScore
+
+#endif  // MSCR_OUTPUT_STANDINGSDELTA_HPP
@@ -0,0 +1,68 @@
+//    Copyright 2025 MaratonaCIn
+//
+//    Licensed under the Apache License, Version 2.0 (the "License");
+//    you may not use this file except in compliance with the License.
+//    You may obtain a copy of the License at
+//
+//        http://www.apache.org/licenses/LICENSE-2.0
+//
+//    Unless required by applicable law or agreed to in writing, software
+//    distributed under the License is distributed on an "AS IS" BASIS,
+//    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//    See the License for the specific language governing permissions and
+//    limitations under the License.
+
+
+#ifndef MSCR_OUTPUT_XLSXEXPORT_HPP
+#define MSCR_OUTPUT_XLSXEXPORT_HPP
+
+#include <cstdint>
+#include <ostream>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include "maratona_score/export.hpp"
+#include "maratona_score/models/Scoreboard.hpp"
+#include "maratona_score/utils/ZipWriter.hpp"
+
+namespace MaratonaScore {
+
+// Writes a single-sheet .xlsx row by row. Strings are stored inline, so
+// nothing but the current output buffer is kept in memory.
+class MARATONASCORE_API XlsxWriter {
+   public:
+    explicit XlsxWriter(std::ostream& os,
+                        const std::string& sheetName = "Sheet1");
+
+    void beginRow();
+    void addCell(std::string_view text);
+    void addCell(double value);
+    void addEmptyCell();
+    void endRow();
+
+    // Closes the sheet and the zip container; call once after the last row.
+    void finish();
+
+   private:
+    ZipWriter zip;
+    std::string buffer;
+    std::vector<std::string> columnNames;  // A, B, ..., grown on demand
+    uint32_t row = 0;
+    uint32_t column = 0;
+
+    void writeReference();
+    void flushIfFull();
+};
+
+// Final standings as a spreadsheet: rank, team, the score columns of
+// scoreboard.csv (plus rating when enabled), then the score of every round
+// (solve + bonus + upsolve) in season order, empty where the contestant did
+// not take part. Dropped contests keep their score here even though the
+// overall score leaves them out.
+MARATONASCORE_API void exportScoreboardXlsx(const Scoreboard& scoreboard,
+                                            std::ostream& os);
+
+}  // namespace MaratonaScore
+
+#endif  // MSCR_OUTPUT_XLSXEXPORT_HPP
@@ -0,0 +1,101 @@
+//    Copyright 2025 MaratonaCIn
+//
+//    Licensed under the Apache License, Version 2.0 (the "License");
+//    you may not use this file except in compliance with the License.
+//    You may obtain a copy of the License at
+//
+//        http://www.apache.org/licenses/LICENSE-2.0
+//
+//    Unless required by applicable law or agreed to in writing, software
+//    distributed under the License is distributed on an "AS IS" BASIS,
+//    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//    See the License for the specific language governing permissions and
+//    limitations under the License.
+
+#ifndef MSCR_PARSER_ASYNCPROCESSOR_HPP
+#define MSCR_PARSER_ASYNCPROCESSOR_HPP
+
+#include <atomic>
+#include <chrono>
+#include <functional>
+#include <future>
+#include <memory>
+#include <stdexcept>
+#include <string>
+#include <thread>
+
+#include "maratona_score/export.hpp"
+#include "maratona_score/models/Scoreboard.hpp"
+
+namespace MaratonaScore {
+
+struct MARATONASCORE_API ProcessProgress {
+    size_t done;   // files folded in (or skipped) so far
+    size_t total;  // files in the season
+    std::string file;
+};
+
+// Thrown by ProcessHandle::get when the run was cancelled.
+class MARATONASCORE_API ProcessCancelled : public std::runtime_error {
+   public:
+    ProcessCancelled() : std::runtime_error("Processing cancelled") {}
+};
+
+struct MARATONASCORE_API ProcessResult {
+    Scoreboard scoreboard;
+    std::string csv;  // scoreboard.renderCSV, when renderCSV is set
+};
+
+struct MARATONASCORE_API ProcessOptions {
+    // Called on the worker thread after each file; keep it short and
+    // hand the update over to the UI thread from there.
+    std::function<void(const ProcessProgress&)> progress;
+    bool renderCSV = true;
+};
+
+class ProcessHandle;
+
+// Loads, scores, filters and renders the season at dataPath (a directory,
+// .zip or .tar) off the calling thread. Settings and Blacklist are read
+// from the worker, so they must not be reloaded while it runs.
+MARATONASCORE_API ProcessHandle processSeasonAsync(const std::string& dataPath,
+                                                   ProcessOptions options = {});
+
+// A season run on its own thread (see processSeasonAsync). Cancellation is
+// cooperative: it is checked after every file and between the stages, so a
+// workbook that is being parsed is finished first. Destroying a handle
+// cancels the run and waits for the thread.
+class MARATONASCORE_API ProcessHandle {
+   public:
+    ProcessHandle() = default;
+    ProcessHandle(ProcessHandle&& other) noexcept = default;
+    ProcessHandle& operator=(ProcessHandle&& other) noexcept;
+    ~ProcessHandle();
+
+    void cancel();
+    bool valid() const;
+    bool ready() const;
+    void wait() const;
+    template <typename Rep, typename Period>
+    bool waitFor(const std::chrono::duration<Rep, Period>& timeout) const {
+        return result.wait_for(timeout) == std::future_status::ready;
+    }
+
+    // Blocks until the run ends. Rethrows ProcessCancelled or whatever the
+    // run failed with; may be called once.
+    ProcessResult get();
+
+   private:
+    friend ProcessHandle processSeasonAsync(const std::string& dataPath,
+                                            ProcessOptions options);
+
+    std::shared_ptr<std::atomic<bool>> cancelled;
+    std::future<ProcessResult> result;
+    std::thread worker;
+
+    void stop();
+};
+
+}  // namespace MaratonaScore
+
+#endif  // MSCR_PARSER_ASYNCPROCESSOR_HPP
@@ -12,9 +12,10 @@
 //    See the License for the specific language governing permissions and
 //    limitations under the License.
 
-#ifndef MSCR_PARSER_SCOREBOARDPARSER_HPP
-#define MSCR_PARSER_SCOREBOARDPARSER_HPP
+#ifndef MSCR_PARSER_FINALPARSER_HPP
+#define MSCR_PARSER_FINALPARSER_HPP
 
+#include <istream>
 #include <string>
 
 #include "maratona_score/export.hpp"
@@ -26,8 +27,9 @@ namespace MaratonaScore {
 class MARATONASCORE_API FinalParser {
    public:
     Contest parse(const std::string& file_path);
+    Contest parse(std::istream& in);
 };
 
 }  // namespace MaratonaScore
 
-#endif  // MSCR_PARSER_SCOREBOARDPARSER_HPP
\ No newline at end of file
+#endif  // MSCR_PARSER_FINALPARSER_HPP
\ No newline at end of file
@@ -0,0 +1,42 @@
+//    Copyright 2025 MaratonaCIn
+//
+//    Licensed under the Apache License, Version 2.0 (the "License");
+//    you may not use this file except in compliance with the License.
+//    You may obtain a copy of the License at
+//
+//        http://www.apache.org/licenses/LICENSE-2.0
+//
+//    Unless required by applicable law or agreed to in writing, software
+//    distributed under the License is distributed on an "AS IS" BASIS,
+//    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//    See the License for the specific language governing permissions and
+//    limitations under the License.
+
+
+#ifndef MSCR_PARSER_REJUDGEPARSER_HPP
+#define MSCR_PARSER_REJUDGEPARSER_HPP
+
+#include <string>
+#include <vector>
+
+#include "maratona_score/export.hpp"
+#include "maratona_score/models/Contest.hpp"
+
+namespace MaratonaScore {
+
+// Reads a rejudge file, one patch per line ('#' starts a comment):
+//
+//   <contest> <team> <problem> AC <h:mm[:ss]> <wrong tries>
+//   <contest> <team> <problem> WA <wrong tries>
+//   <contest> <team> <problem> CLEAR
+//
+// Team IDs with spaces go in double quotes. Aliases are resolved, and lines
+// for blacklisted teams are dropped with a warning.
+class MARATONASCORE_API RejudgeParser {
+   public:
+    std::vector<RejudgePatch> parse(const std::string& file_path);
+};
+
+}  // namespace MaratonaScore
+
+#endif  // MSCR_PARSER_REJUDGEPARSER_HPP
@@ -16,7 +16,10 @@
 #ifndef MSCR_PARSER_SCOREBOARDPARSER_HPP
 #define MSCR_PARSER_SCOREBOARDPARSER_HPP
 
+#include <functional>
 #include <string>
+#include <string_view>
+#include <vector>
 
 #include "maratona_score/export.hpp"
 #include "maratona_score/models/Contest.hpp"
@@ -26,7 +29,33 @@ namespace MaratonaScore {
 
 class MARATONASCORE_API ScoreboardParser {
    public:
+    // Cell text of one sheet row, starting at column 1.
+    using RawRow = std::vector<std::string>;
+
+    // Decides which (alias-resolved) team IDs a parse keeps. Ranks and rank
+    // bonuses are then those among the kept rows only.
+    using TeamFilter = std::function<bool(const std::string& teamID)>;
+
+    ScoreboardParser() = default;
+    explicit ScoreboardParser(TeamFilter keep);
+
     Contest parse(const std::string& file_path, CONTEST_TYPE contestType);
+
+    // Parses an .xlsx already in memory, e.g. an entry of a season bundle.
+    Contest parseWorkbook(std::string_view workbook,
+                          const std::string& contestId,
+                          CONTEST_TYPE contestType);
+
+    // Decodes a sheet already read into memory. rows[0] is the header: it
+    // locates the team, score and penalty columns and names the problems
+    // (labels past Z continue as AA, AB...). Row ranges are decoded on
+    // PARSER_THREADS threads and merged in sheet order before ranking, so
+    // the result does not depend on the thread count.
+    Contest parseRows(const std::vector<RawRow>& rows,
+                      const std::string& contestId, CONTEST_TYPE contestType);
+
+   private:
+    TeamFilter keep;
 };
 
 }  // namespace MaratonaScore
@@ -0,0 +1,51 @@
+//    Copyright 2025 MaratonaCIn
+//
+//    Licensed under the Apache License, Version 2.0 (the "License");
+//    you may not use this file except in compliance with the License.
+//    You may obtain a copy of the License at
+//
+//        http://www.apache.org/licenses/LICENSE-2.0
+//
+//    Unless required by applicable law or agreed to in writing, software
+//    distributed under the License is distributed on an "AS IS" BASIS,
+//    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//    See the License for the specific language governing permissions and
+//    limitations under the License.
+
+
+#ifndef MSCR_PARSER_SEASONBUNDLE_HPP
+#define MSCR_PARSER_SEASONBUNDLE_HPP
+
+#include <string>
+#include <string_view>
+#include <unordered_map>
+
+#include "maratona_score/export.hpp"
+#include "maratona_score/utils/Archive.hpp"
+#include "maratona_score/utils/MappedFile.hpp"
+
+namespace MaratonaScore {
+
+// A season packed in a single .zip or .tar. The bundle is memory-mapped and
+// its files are looked up by base name, so both a flat archive and one with
+// a top-level folder work. Nothing is extracted to disk.
+class MARATONASCORE_API SeasonBundle {
+   public:
+    explicit SeasonBundle(const std::string& path);
+
+    static bool isBundle(const std::string& path);
+
+    bool contains(const std::string& name) const;
+
+    // Contents of `name`; may point into `buffer` if the entry is compressed.
+    std::string_view read(const std::string& name, std::string& buffer) const;
+
+   private:
+    MappedFile file;
+    Archive archive;
+    std::unordered_map<std::string, const Archive::Entry*> byName;
+};
+
+}  // namespace MaratonaScore
+
+#endif  // MSCR_PARSER_SEASONBUNDLE_HPP
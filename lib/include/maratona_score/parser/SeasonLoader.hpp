@@ -0,0 +1,80 @@
+//    Copyright 2025 MaratonaCIn
+//
+//    Licensed under the Apache License, Version 2.0 (the "License");
+//    you may not use this file except in compliance with the License.
+//    You may obtain a copy of the License at
+//
+//        http://www.apache.org/licenses/LICENSE-2.0
+//
+//    Unless required by applicable law or agreed to in writing, software
+//    distributed under the License is distributed on an "AS IS" BASIS,
+//    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//    See the License for the specific language governing permissions and
+//    limitations under the License.
+
+#ifndef MSCR_PARSER_SEASONLOADER_HPP
+#define MSCR_PARSER_SEASONLOADER_HPP
+
+#include <functional>
+#include <memory>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "maratona_score/export.hpp"
+#include "maratona_score/models/Contest.hpp"
+#include "maratona_score/models/Scoreboard.hpp"
+#include "maratona_score/models/StreamingScoreboard.hpp"
+#include "maratona_score/parser/ScoreboardParser.hpp"
+#include "maratona_score/parser/SeasonBundle.hpp"
+
+namespace MaratonaScore {
+
+struct MARATONASCORE_API SeasonFile {
+    std::string path;
+    CONTEST_TYPE type;
+    int index;
+    bool finals;
+};
+
+// Discovers the files of a season directory (1.xlsx..N.xlsx, H1.xlsx..HN.xlsx
+// and finals.txt) in the order the scoreboard folds them in. basePath may
+// also be a .zip or .tar bundle, read in place through a SeasonBundle; the
+// file paths are then the names of its entries.
+class MARATONASCORE_API SeasonLoader {
+   public:
+    explicit SeasonLoader(const std::string& basePath);
+
+    std::vector<SeasonFile> listFiles() const;
+    Contest load(const SeasonFile& file) const;
+    // Only the teams `keep` accepts; see ScoreboardParser::TeamFilter. The
+    // finals are ranked over the whole file before filtering.
+    Contest load(const SeasonFile& file,
+                 const ScoreboardParser::TeamFilter& keep) const;
+    std::vector<Contest> loadAll() const;
+
+    // Contests and homeworks, then drop-worst filtering, then finals.
+    // Each file is parsed, folded in and released before the next one.
+    void populate(Scoreboard& scoreboard) const;
+    void populate(StreamingScoreboard& scoreboard) const;
+
+    // Same as populate, but keeps the parsed contests (e.g. to apply
+    // rejudge patches to the scoreboard afterwards).
+    void populate(Scoreboard& scoreboard,
+                  std::vector<std::pair<SeasonFile, Contest>>& loaded) const;
+
+    // Called after each file is folded in (or skipped because it failed to
+    // load) with the number of files done and the total. An exception thrown
+    // from it stops populate before the next file.
+    using FileCallback =
+        std::function<void(const SeasonFile& file, size_t done, size_t total)>;
+    void populate(Scoreboard& scoreboard, const FileCallback& afterFile) const;
+
+   private:
+    std::string basePath;
+    std::shared_ptr<SeasonBundle> bundle;
+};
+
+}  // namespace MaratonaScore
+
+#endif  // MSCR_PARSER_SEASONLOADER_HPP
@@ -0,0 +1,103 @@
+//    Copyright 2025 MaratonaCIn
+//
+//    Licensed under the Apache License, Version 2.0 (the "License");
+//    you may not use this file except in compliance with the License.
+//    You may obtain a copy of the License at
+//
+//        http://www.apache.org/licenses/LICENSE-2.0
+//
+//    Unless required by applicable law or agreed to in writing, software
+//    distributed under the License is distributed on an "AS IS" BASIS,
+//    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//    See the License for the specific language governing permissions and
+//    limitations under the License.
+
+
+#ifndef MSCR_PARSER_SHARDEDSEASON_HPP
+#define MSCR_PARSER_SHARDEDSEASON_HPP
+
+#include <istream>
+#include <ostream>
+#include <string>
+#include <vector>
+
+#include "maratona_score/export.hpp"
+#include "maratona_score/models/Scoreboard.hpp"
+#include "maratona_score/parser/SeasonLoader.hpp"
+#include "maratona_score/score/ScoringPolicy.hpp"
+
+namespace MaratonaScore {
+
+// Sharded scoring splits the contestants of a season over several workers
+// (processes, possibly on other machines) by a stable hash of their
+// alias-resolved team ID, so no worker holds the whole scoreboard:
+//
+//   1. tally:  each worker parses its shard of every round and reports what
+//              the other shards need: participants and solvers per problem
+//              (for difficulty-weighted values) and its best results, up to
+//              the number of bonus positions.
+//   2. merge:  the coordinator sums the tallies and merges the best results
+//              into the global leaders of each round (SeasonTally::merge).
+//   3. score:  each worker parses its shard again, takes rank bonuses from
+//              the global leaders and problem values from the global tally,
+//              and writes its standings as a sorted run.
+//   4. merge:  the coordinator merges the runs (mergeShardRuns).
+//
+// The result is the same scoreboard.csv as a single-process run; ratings
+// need every result of a round and are not computed.
+struct MARATONASCORE_API ShardSpec {
+    int index = 0;
+    int count = 1;
+
+    bool owns(const std::string& teamID) const;
+};
+
+struct MARATONASCORE_API RoundLeader {
+    std::string teamID;
+    int solved;
+    int penalty;
+};
+
+struct MARATONASCORE_API RoundTally {
+    std::string round;  // season file name, e.g. "3.xlsx"
+    bool finals = false;
+    ContestTally problems;
+    std::vector<RoundLeader> leaders;  // best first
+};
+
+// Rounds in season order. Saved as text, one "round", "solvers" or "leader"
+// line at a time, so it can travel between machines as a plain file.
+struct MARATONASCORE_API SeasonTally {
+    std::vector<RoundTally> rounds;
+
+    void save(std::ostream& os) const;
+    static SeasonTally load(std::istream& is);
+
+    // Sums the shards' tallies; leaders are re-ranked and cut to the bonus
+    // positions.
+    static SeasonTally merge(const std::vector<SeasonTally>& shards);
+};
+
+class MARATONASCORE_API ShardWorker {
+   public:
+    ShardWorker(const std::string& dataPath, ShardSpec shard);
+
+    SeasonTally tally() const;
+
+    // Folds this shard into `scoreboard` (contests and homeworks, drop-worst,
+    // then finals, like SeasonLoader::populate).
+    void score(const SeasonTally& global, Scoreboard& scoreboard) const;
+
+   private:
+    SeasonLoader loader;
+    ShardSpec shard;
+};
+
+// Merges runs written by Scoreboard::renderRun into a scoreboard.csv, in the
+// order Scoreboard::getRanking gives (total descending, then team ID).
+MARATONASCORE_API void mergeShardRuns(const std::vector<std::istream*>& runs,
+                                      std::ostream& csv);
+
+}  // namespace MaratonaScore
+
+#endif  // MSCR_PARSER_SHARDEDSEASON_HPP
@@ -0,0 +1,40 @@
+//    Copyright 2025 MaratonaCIn
+//
+//    Licensed under the Apache License, Version 2.0 (the "License");
+//    you may not use this file except in compliance with the License.
+//    You may obtain a copy of the License at
+//
+//        http://www.apache.org/licenses/LICENSE-2.0
+//
+//    Unless required by applicable law or agreed to in writing, software
+//    distributed under the License is distributed on an "AS IS" BASIS,
+//    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//    See the License for the specific language governing permissions and
+//    limitations under the License.
+
+
+#ifndef MSCR_PARSER_XLSXREADER_HPP
+#define MSCR_PARSER_XLSXREADER_HPP
+
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include "maratona_score/export.hpp"
+
+namespace MaratonaScore {
+
+// Minimal reader for the first worksheet of an .xlsx held in memory. It
+// returns the text of every cell (shared, inline and plain values) as
+// rows of columns starting at A, which is all the vJudge parser needs.
+// Throws std::runtime_error, naming the worksheet, on references past the
+// OOXML limits or a sheet that would span far more cells than it holds.
+class MARATONASCORE_API XlsxReader {
+   public:
+    std::vector<std::vector<std::string>> readFirstSheet(
+        std::string_view workbook);
+};
+
+}  // namespace MaratonaScore
+
+#endif  // MSCR_PARSER_XLSXREADER_HPP
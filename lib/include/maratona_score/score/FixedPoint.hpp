@@ -0,0 +1,41 @@
+//    Copyright 2025 MaratonaCIn
+//
+//    Licensed under the Apache License, Version 2.0 (the "License");
+//    you may not use this file except in compliance with the License.
+//    You may obtain a copy of the License at
+//
+//        http://www.apache.org/licenses/LICENSE-2.0
+//
+//    Unless required by applicable law or agreed to in writing, software
+//    distributed under the License is distributed on an "AS IS" BASIS,
+//    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//    See the License for the specific language governing permissions and
+//    limitations under the License.
+
+
+#ifndef MSCR_SCORE_FIXEDPOINT_HPP
+#define MSCR_SCORE_FIXEDPOINT_HPP
+
+#include <cmath>
+#include <cstdint>
+
+namespace MaratonaScore {
+
+// Scores are stored in millionths of a point. Every weighted value is rounded
+// once, when it is derived from the configuration, so sums of scores are exact
+// and do not depend on the order in which contests are added.
+using ScoreValue = std::int64_t;
+
+constexpr ScoreValue SCORE_SCALE = 1000000;
+
+inline ScoreValue toFixed(double value) {
+    return static_cast<ScoreValue>(std::llround(value * SCORE_SCALE));
+}
+
+inline double toDouble(ScoreValue value) {
+    return static_cast<double>(value) / SCORE_SCALE;
+}
+
+}  // namespace MaratonaScore
+
+#endif  // MSCR_SCORE_FIXEDPOINT_HPP
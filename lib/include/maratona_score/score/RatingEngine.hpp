@@ -0,0 +1,62 @@
+//    Copyright 2025 MaratonaCIn
+//
+//    Licensed under the Apache License, Version 2.0 (the "License");
+//    you may not use this file except in compliance with the License.
+//    You may obtain a copy of the License at
+//
+//        http://www.apache.org/licenses/LICENSE-2.0
+//
+//    Unless required by applicable law or agreed to in writing, software
+//    distributed under the License is distributed on an "AS IS" BASIS,
+//    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//    See the License for the specific language governing permissions and
+//    limitations under the License.
+
+
+#ifndef MSCR_SCORE_RATINGENGINE_HPP
+#define MSCR_SCORE_RATINGENGINE_HPP
+
+#include <map>
+#include <string>
+
+#include "maratona_score/export.hpp"
+#include "maratona_score/models/Contest.hpp"
+
+namespace MaratonaScore {
+
+// Elo-style rating track updated from the ranks of each CONTEST round.
+//
+// A contestant's expected rank is 1 + sum of P(other beats them) with the
+// usual logistic 400-point curve. Instead of comparing every pair, ratings are
+// binned into RATING_BIN wide buckets and the expected rank is computed once
+// per bucket, so an update is O(n log n + buckets^2) regardless of field size.
+// The performance rating is the one whose expected rank is the geometric mean
+// of expected and actual rank; ratings move half way towards it and the
+// deltas are shifted to sum to zero.
+class MARATONASCORE_API RatingEngine {
+   public:
+    struct Rating {
+        double rating;
+        int contests;
+    };
+
+    static constexpr int RATING_BIN = 4;
+
+    // Homeworks and contests without performances are ignored.
+    void update(const Contest& contest);
+
+    bool hasRating(const std::string& teamID) const;
+    double getRating(const std::string& teamID) const;
+    const std::map<std::string, Rating>& getRatings() const;
+
+    // CSV with "Team ID,Rating,Contests" rows, for multi-season tracks.
+    void save(const std::string& path) const;
+    void load(const std::string& path);
+
+   private:
+    std::map<std::string, Rating> ratings;
+};
+
+}  // namespace MaratonaScore
+
+#endif  // MSCR_SCORE_RATINGENGINE_HPP
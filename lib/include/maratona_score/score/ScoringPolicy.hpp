@@ -0,0 +1,222 @@
+//    Copyright 2025 MaratonaCIn
+//
+//    Licensed under the Apache License, Version 2.0 (the "License");
+//    you may not use this file except in compliance with the License.
+//    You may obtain a copy of the License at
+//
+//        http://www.apache.org/licenses/LICENSE-2.0
+//
+//    Unless required by applicable law or agreed to in writing, software
+//    distributed under the License is distributed on an "AS IS" BASIS,
+//    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//    See the License for the specific language governing permissions and
+//    limitations under the License.
+
+#ifndef MSCR_SCORE_SCORINGPOLICY_HPP
+#define MSCR_SCORE_SCORINGPOLICY_HPP
+
+#include <algorithm>
+#include <cmath>
+#include <map>
+#include <string>
+
+#include "maratona_score/models/Contest.hpp"
+#include "maratona_score/models/Performance.hpp"
+#include "maratona_score/score/FixedPoint.hpp"
+#include "maratona_score/utils/Settings.hpp"
+
+namespace MaratonaScore {
+
+// ----------------------------------------------------------------------------
+// Weighting curves: multiplier of contest `index` out of `contests`.
+// ----------------------------------------------------------------------------
+struct ExponentialWeight {
+    static double apply(int index, int contests) {
+        return std::pow(2, double(index) / contests);
+    }
+};
+
+struct LinearWeight {
+    static double apply(int index, int contests) {
+        return 1.0 + double(index) / contests;
+    }
+};
+
+struct FlatWeight {
+    static double apply(int, int) { return 1.0; }
+};
+
+// ----------------------------------------------------------------------------
+// Problem values. Each policy builds a Scorer once per contest; its call
+// operator is the only thing that runs per performance.
+// ----------------------------------------------------------------------------
+// What a Scorer may need from the whole round: participants and solvers per
+// problem. Built from the contest itself, or summed over the shards of a
+// sharded run (each shard holds only part of the contest).
+struct ContestTally {
+    size_t participants = 0;
+    std::map<std::string, int> solvers;
+
+    static ContestTally of(const Contest& contest) {
+        ContestTally tally;
+        tally.participants = contest.getPerformances().size();
+        for (const auto& [teamID, performance] : contest.getPerformances()) {
+            for (const auto& [problemId, status] : performance.getProblems()) {
+                if (status.getStatus() == SOLVED) tally.solvers[problemId]++;
+            }
+        }
+        return tally;
+    }
+
+    void merge(const ContestTally& other) {
+        participants += other.participants;
+        for (const auto& [problemId, count] : other.solvers) {
+            solvers[problemId] += count;
+        }
+    }
+};
+
+struct FlatValue {
+    class Scorer {
+       public:
+        Scorer(const Contest&, ScoreValue unit) : unit(unit) {}
+        Scorer(const ContestTally&, ScoreValue unit) : unit(unit) {}
+
+        ScoreValue operator()(const Performance& performance) const {
+            return performance.getProblemsSolved() * unit;
+        }
+
+       private:
+        ScoreValue unit;
+    };
+};
+
+// A problem is worth unit * (1 + DIFFICULTY_FACTOR * (1 - solvers / n)), so a
+// problem nobody else solved is worth up to (1 + factor) times the flat value.
+struct DifficultyValue {
+    class Scorer {
+       public:
+        Scorer(const Contest& contest, ScoreValue unit)
+            : Scorer(ContestTally::of(contest), unit) {}
+
+        Scorer(const ContestTally& tally, ScoreValue unit) {
+            const double n = std::max<size_t>(1, tally.participants);
+            const double factor = Settings::getInstance().DIFFICULTY_FACTOR;
+            for (const auto& [problemId, count] : tally.solvers) {
+                values[problemId] = static_cast<ScoreValue>(std::llround(
+                    unit * (1.0 + factor * (1.0 - count / n))));
+            }
+        }
+
+        ScoreValue operator()(const Performance& performance) const {
+            ScoreValue score = 0;
+            for (const auto& [problemId, status] : performance.getProblems()) {
+                if (status.getStatus() == SOLVED) score += values.at(problemId);
+            }
+            return score;
+        }
+
+       private:
+        std::map<std::string, ScoreValue> values;
+    };
+};
+
+// ----------------------------------------------------------------------------
+// Bonus schedules for ranks 1..personBonus.
+// ----------------------------------------------------------------------------
+struct LinearBonus {
+    static double apply(double baseBonus, int personBonus, int rank) {
+        return baseBonus *
+               std::max(0.0, (double)(personBonus - rank + 1) / personBonus);
+    }
+};
+
+struct GeometricBonus {
+    static double apply(double baseBonus, int, int rank) {
+        return baseBonus / std::pow(2, rank - 1);
+    }
+};
+
+template <typename Weight, typename Value, typename Bonus>
+struct ScoringPolicy {
+    static ScoreValue problemValue(CONTEST_TYPE contestType, int contestIndex) {
+        const Settings& settings = Settings::getInstance();
+        double base = 0.0;
+        if (contestType == CONTEST) {
+            base = settings.CONTEST_BASE_VALUE;
+        } else if (contestType == HOMEWORK) {
+            base = settings.HOMEWORK_BASE_VALUE;
+        }
+        return toFixed(base *
+                       Weight::apply(contestIndex, settings.NUMBER_OF_CONTESTS));
+    }
+
+    static typename Value::Scorer solveScorer(const Contest& contest,
+                                              int contestIndex) {
+        return typename Value::Scorer(
+            contest, problemValue(contest.getType(), contestIndex));
+    }
+
+    static typename Value::Scorer solveScorer(const ContestTally& tally,
+                                              CONTEST_TYPE contestType,
+                                              int contestIndex) {
+        return typename Value::Scorer(tally,
+                                      problemValue(contestType, contestIndex));
+    }
+
+    static ScoreValue rankBonus(CONTEST_TYPE contestType, int rank) {
+        const Settings& settings = Settings::getInstance();
+        if (rank < 1 || rank > settings.CONTEST_PERSON_BONUS) {
+            return 0;
+        }
+
+        if (contestType == CONTEST) {
+            return toFixed(Bonus::apply(settings.CONTEST_SCORE_BONUS,
+                                        settings.CONTEST_PERSON_BONUS, rank));
+        }
+        if (contestType == HOMEWORK) {
+            return toFixed(Bonus::apply(settings.HOMEWORK_SCORE_BONUS,
+                                        settings.HOMEWORK_PERSON_BONUS, rank));
+        }
+        return 0;
+    }
+};
+
+namespace detail {
+
+template <typename Weight, typename Value, typename F>
+decltype(auto) withBonus(F&& f) {
+    if (Settings::getInstance().SCORE_BONUS_SCHEDULE == GEOMETRIC_BONUS) {
+        return f(ScoringPolicy<Weight, Value, GeometricBonus>{});
+    }
+    return f(ScoringPolicy<Weight, Value, LinearBonus>{});
+}
+
+template <typename Weight, typename F>
+decltype(auto) withValue(F&& f) {
+    if (Settings::getInstance().SCORE_PROBLEM_VALUE == DIFFICULTY_VALUE) {
+        return withBonus<Weight, DifficultyValue>(f);
+    }
+    return withBonus<Weight, FlatValue>(f);
+}
+
+}  // namespace detail
+
+// Calls f with the ScoringPolicy selected in config.yaml. The choice is made
+// once per call, so loops written inside f are compiled per policy.
+template <typename F>
+decltype(auto) withScoringPolicy(F&& f) {
+    switch (Settings::getInstance().SCORE_WEIGHTING) {
+        case LINEAR_WEIGHTING:
+            return detail::withValue<LinearWeight>(f);
+        case FLAT_WEIGHTING:
+            return detail::withValue<FlatWeight>(f);
+        case EXPONENTIAL_WEIGHTING:
+        default:
+            return detail::withValue<ExponentialWeight>(f);
+    }
+}
+
+}  // namespace MaratonaScore
+
+#endif  // MSCR_SCORE_SCORINGPOLICY_HPP
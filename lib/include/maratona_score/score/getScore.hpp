@@ -19,11 +19,14 @@
 #include "maratona_score/export.hpp"
 #include "maratona_score/models/Performance.hpp"
 #include "maratona_score/models/Contest.hpp"
+#include "maratona_score/score/FixedPoint.hpp"
 
 namespace MaratonaScore {
-    MARATONASCORE_API double getSolveScore(CONTEST_TYPE contestType, const Performance& performance, int contestIndex);
-    MARATONASCORE_API double getUpsolveScore(const Performance& performance);
-    MARATONASCORE_API double getRankBonus(CONTEST_TYPE contestType, int rank);
+    // Flat per-problem value under the configured weighting curve. Difficulty
+    // weighted scoring needs the whole contest, see ScoringPolicy.hpp.
+    MARATONASCORE_API ScoreValue getSolveScore(CONTEST_TYPE contestType, const Performance& performance, int contestIndex);
+    MARATONASCORE_API ScoreValue getUpsolveScore(const Performance& performance);
+    MARATONASCORE_API ScoreValue getRankBonus(CONTEST_TYPE contestType, int rank);
 
 } // namespace MaratonaScore
 #endif // MSCR_SCORE_GETSCORE_HPP
\ No newline at end of file
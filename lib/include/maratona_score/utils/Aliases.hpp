@@ -0,0 +1,51 @@
+//    Copyright 2025 MaratonaCIn
+//
+//    Licensed under the Apache License, Version 2.0 (the "License");
+//    you may not use this file except in compliance with the License.
+//    You may obtain a copy of the License at
+//
+//        http://www.apache.org/licenses/LICENSE-2.0
+//
+//    Unless required by applicable law or agreed to in writing, software
+//    distributed under the License is distributed on an "AS IS" BASIS,
+//    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//    See the License for the specific language governing permissions and
+//    limitations under the License.
+
+#ifndef MSCR_UTILS_ALIASES_HPP
+#define MSCR_UTILS_ALIASES_HPP
+
+#include <string>
+
+#include "maratona_score/export.hpp"
+
+namespace MaratonaScore {
+
+// Maps every handle a contestant used to one team ID before anything is
+// scored. Identities are interned into a union-find index, so a lookup is a
+// hash probe plus a near-constant find. The alias file has one identity per
+// line, canonical ID first, separated by '|':
+//
+//     Lucas Vidal | lucasv | lucas_vidal_2024
+//
+// With aliases.normalize_names in config.yaml, IDs that only differ in case,
+// Latin-1 accents, spacing or underscores are merged as well; the first one
+// seen (or the canonical ID of the alias file) is kept.
+class MARATONASCORE_API Aliases {
+   public:
+    static void loadFromFile(const std::string& filepath);
+    static void addAlias(const std::string& canonical,
+                         const std::string& alias);
+
+    // Canonical ID of teamID (teamID itself when it has no alias).
+    static std::string resolve(const std::string& teamID);
+    static void clear();
+
+    // Lowercase, Latin-1 accents folded to ASCII, runs of whitespace and
+    // underscores collapsed to one space.
+    static std::string normalize(const std::string& name);
+};
+
+}  // namespace MaratonaScore
+
+#endif  // MSCR_UTILS_ALIASES_HPP
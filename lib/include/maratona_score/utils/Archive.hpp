@@ -0,0 +1,65 @@
+//    Copyright 2025 MaratonaCIn
+//
+//    Licensed under the Apache License, Version 2.0 (the "License");
+//    you may not use this file except in compliance with the License.
+//    You may obtain a copy of the License at
+//
+//        http://www.apache.org/licenses/LICENSE-2.0
+//
+//    Unless required by applicable law or agreed to in writing, software
+//    distributed under the License is distributed on an "AS IS" BASIS,
+//    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//    See the License for the specific language governing permissions and
+//    limitations under the License.
+
+
+#ifndef MSCR_UTILS_ARCHIVE_HPP
+#define MSCR_UTILS_ARCHIVE_HPP
+
+#include <cstdint>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include "maratona_score/export.hpp"
+
+namespace MaratonaScore {
+
+// Index over a zip or ustar tar archive that is already in memory (for
+// instance a MappedFile, or an .xlsx read out of another archive). Only the
+// directory is parsed up front; entries are located or inflated on demand.
+// Stored entries are returned as views into the archive, without copying.
+class MARATONASCORE_API Archive {
+   public:
+    struct Entry {
+        std::string name;
+        uint16_t method;  // 0 = stored, 8 = deflate
+        uint64_t offset;  // zip: local header, tar: first data byte
+        uint64_t compressedSize;
+        uint64_t size;
+    };
+
+    // The archive bytes must outlive the Archive.
+    explicit Archive(std::string_view bytes);
+
+    static bool isZip(std::string_view bytes);
+    static bool isTar(std::string_view bytes);
+
+    const std::vector<Entry>& getEntries() const;
+    const Entry* find(const std::string& name) const;
+
+    // Contents of `entry`: a view into the archive when stored, otherwise
+    // inflated into `buffer` (which the view then points to).
+    std::string_view read(const Entry& entry, std::string& buffer) const;
+
+   private:
+    std::string_view bytes;
+    std::vector<Entry> entries;
+
+    void indexZip();
+    void indexTar();
+};
+
+}  // namespace MaratonaScore
+
+#endif  // MSCR_UTILS_ARCHIVE_HPP
@@ -0,0 +1,54 @@
+//    Copyright 2025 MaratonaCIn
+//
+//    Licensed under the Apache License, Version 2.0 (the "License");
+//    you may not use this file except in compliance with the License.
+//    You may obtain a copy of the License at
+//
+//        http://www.apache.org/licenses/LICENSE-2.0
+//
+//    Unless required by applicable law or agreed to in writing, software
+//    distributed under the License is distributed on an "AS IS" BASIS,
+//    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//    See the License for the specific language governing permissions and
+//    limitations under the License.
+
+
+#ifndef MSCR_UTILS_MAPPEDFILE_HPP
+#define MSCR_UTILS_MAPPEDFILE_HPP
+
+#include <cstddef>
+#include <string>
+#include <string_view>
+
+#include "maratona_score/export.hpp"
+
+namespace MaratonaScore {
+
+// Read-only memory mapping of a whole file (mmap, or a file mapping on
+// Windows). The contents stay valid for the lifetime of the object.
+class MARATONASCORE_API MappedFile {
+   public:
+    explicit MappedFile(const std::string& path);
+    ~MappedFile();
+
+    MappedFile(const MappedFile&) = delete;
+    MappedFile& operator=(const MappedFile&) = delete;
+
+    const char* data() const;
+    size_t size() const;
+    std::string_view view() const;
+
+   private:
+    const char* begin = nullptr;
+    size_t length = 0;
+#ifdef _WIN32
+    void* file = nullptr;
+    void* mapping = nullptr;
+#else
+    int fd = -1;
+#endif
+};
+
+}  // namespace MaratonaScore
+
+#endif  // MSCR_UTILS_MAPPEDFILE_HPP
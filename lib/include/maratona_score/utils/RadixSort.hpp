@@ -0,0 +1,66 @@
+//    Copyright 2025 MaratonaCIn
+//
+//    Licensed under the Apache License, Version 2.0 (the "License");
+//    you may not use this file except in compliance with the License.
+//    You may obtain a copy of the License at
+//
+//        http://www.apache.org/licenses/LICENSE-2.0
+//
+//    Unless required by applicable law or agreed to in writing, software
+//    distributed under the License is distributed on an "AS IS" BASIS,
+//    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//    See the License for the specific language governing permissions and
+//    limitations under the License.
+
+
+#ifndef MSCR_UTILS_RADIXSORT_HPP
+#define MSCR_UTILS_RADIXSORT_HPP
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <utility>
+#include <vector>
+
+namespace MaratonaScore {
+
+// Stable LSD radix sort of `items` by an unsigned 64-bit key, ascending.
+// Byte passes in which every key has the same digit are skipped, so small
+// score ranges cost only a couple of passes.
+template <typename T, typename KeyFn>
+void radixSort(std::vector<T>& items, KeyFn key) {
+    const size_t n = items.size();
+    if (n < 2) return;
+
+    std::vector<std::uint64_t> keys(n), keysTmp(n);
+    std::vector<T> tmp(n);
+    for (size_t i = 0; i < n; i++) keys[i] = key(items[i]);
+
+    for (int shift = 0; shift < 64; shift += 8) {
+        std::array<size_t, 257> offsets{};
+        for (size_t i = 0; i < n; i++) {
+            offsets[((keys[i] >> shift) & 0xFF) + 1]++;
+        }
+        if (offsets[((keys[0] >> shift) & 0xFF) + 1] == n) continue;
+
+        for (size_t d = 1; d < offsets.size(); d++) {
+            offsets[d] += offsets[d - 1];
+        }
+        for (size_t i = 0; i < n; i++) {
+            size_t pos = offsets[(keys[i] >> shift) & 0xFF]++;
+            tmp[pos] = std::move(items[i]);
+            keysTmp[pos] = keys[i];
+        }
+        items.swap(tmp);
+        keys.swap(keysTmp);
+    }
+}
+
+// Maps a signed score to a key whose ascending order is descending score.
+inline std::uint64_t descendingKey(std::int64_t value) {
+    return ~(static_cast<std::uint64_t>(value) ^ (std::uint64_t(1) << 63));
+}
+
+}  // namespace MaratonaScore
+
+#endif  // MSCR_UTILS_RADIXSORT_HPP
@@ -21,6 +21,10 @@
 
 namespace MaratonaScore {
 
+enum WEIGHTING_CURVE { EXPONENTIAL_WEIGHTING, LINEAR_WEIGHTING, FLAT_WEIGHTING };
+enum PROBLEM_VALUE { FLAT_VALUE, DIFFICULTY_VALUE };
+enum BONUS_SCHEDULE { LINEAR_BONUS, GEOMETRIC_BONUS };
+
 class MARATONASCORE_API Settings {
    public:
     static Settings& getInstance();
@@ -51,6 +55,22 @@ class MARATONASCORE_API Settings {
     int NUMBER_OF_CONTESTS;
     int IGNORE_WORST_CONTESTS;
 
+    // Scoring policies
+    WEIGHTING_CURVE SCORE_WEIGHTING;
+    PROBLEM_VALUE SCORE_PROBLEM_VALUE;
+    BONUS_SCHEDULE SCORE_BONUS_SCHEDULE;
+    double DIFFICULTY_FACTOR;
+
+    // Parser
+    int PARSER_THREADS;
+
+    // Rating track
+    bool RATING_ENABLED;
+    double RATING_INITIAL;
+
+    // Aliases
+    bool ALIAS_NORMALIZE_NAMES;
+
    private:
     Settings();
     void setDefaultValues();
@@ -16,9 +16,11 @@
 #define MSCR_UTILS_STRING_UTILS_HPP
 
 #include <algorithm>
+#include <cstdint>
 #include <sstream>
 #include <stdexcept>
 #include <string>
+#include <string_view>
 #include <vector>
 
 namespace MaratonaScore {
@@ -26,6 +28,20 @@ namespace MaratonaScore {
 int timeStringToMinutes(const std::string& timeStr);
 std::string trim(const std::string& s);
 
+// Zero-based slot of contest id "7" (prefix "") or "H7" (prefix "H") in a
+// season of `slots` rounds, or -1.
+int contestSlot(const std::string& contestId, const std::string& prefix,
+                int slots);
+
+// Contests first (1, 2, ..., 10), then homeworks (H1, H2, ...), then the rest.
+bool contestIdLess(const std::string& a, const std::string& b);
+
+// 64-bit FNV-1a. Unlike std::hash it is the same on every run and machine.
+uint64_t fnv1a(std::string_view data);
+
+// Appends text with &, <, > and " escaped, for HTML and XML.
+void appendEscaped(std::string& out, std::string_view text);
+
 }  // namespace MaratonaScore
 
 #endif  // MSCR_UTILS_STRING_UTILS_HPP
\ No newline at end of file
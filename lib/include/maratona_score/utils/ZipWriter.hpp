@@ -0,0 +1,75 @@
+//    Copyright 2025 MaratonaCIn
+//
+//    Licensed under the Apache License, Version 2.0 (the "License");
+//    you may not use this file except in compliance with the License.
+//    You may obtain a copy of the License at
+//
+//        http://www.apache.org/licenses/LICENSE-2.0
+//
+//    Unless required by applicable law or agreed to in writing, software
+//    distributed under the License is distributed on an "AS IS" BASIS,
+//    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//    See the License for the specific language governing permissions and
+//    limitations under the License.
+
+
+#ifndef MSCR_UTILS_ZIPWRITER_HPP
+#define MSCR_UTILS_ZIPWRITER_HPP
+
+#include <cstdint>
+#include <memory>
+#include <ostream>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include "maratona_score/export.hpp"
+
+namespace MaratonaScore {
+
+// Streaming zip writer: entries are deflated straight into the output and
+// their sizes and CRC follow in a data descriptor, so the stream never has
+// to seek back and only the central directory is kept in memory. No ZIP64:
+// entries and archives are limited to 4 GiB and 65535 entries.
+class MARATONASCORE_API ZipWriter {
+   public:
+    explicit ZipWriter(std::ostream& os, int level = 1);
+    ~ZipWriter();
+
+    ZipWriter(const ZipWriter&) = delete;
+    ZipWriter& operator=(const ZipWriter&) = delete;
+
+    void beginEntry(const std::string& name);
+    void write(std::string_view data);
+    void endEntry();
+
+    // Writes the central directory. Must be called once, after the last entry.
+    void finish();
+
+   private:
+    struct Entry {
+        std::string name;
+        uint32_t crc;
+        uint32_t compressedSize;
+        uint32_t size;
+        uint32_t offset;
+    };
+
+    struct Deflater;
+
+    std::ostream& os;
+    int level;
+    uint64_t written = 0;
+    std::vector<Entry> entries;
+    std::unique_ptr<Deflater> deflater;  // open entry, if any
+    std::vector<char> chunk;
+
+    void put(const void* data, size_t size);
+    void put16(uint16_t value);
+    void put32(uint32_t value);
+    void drain(int flush);
+};
+
+}  // namespace MaratonaScore
+
+#endif  // MSCR_UTILS_ZIPWRITER_HPP
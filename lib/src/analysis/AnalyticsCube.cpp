@@ -0,0 +1,371 @@
+//    Copyright 2025 MaratonaCIn
+//
+//    Licensed under the Apache License, Version 2.0 (the "License");
+//    you may not use this file except in compliance with the License.
+//    You may obtain a copy of the License at
+//
+//        http://www.apache.org/licenses/LICENSE-2.0
+//
+//    Unless required by applicable law or agreed to in writing, software
+//    distributed under the License is distributed on an "AS IS" BASIS,
+//    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//    See the License for the specific language governing permissions and
+//    limitations under the License.
+
+#include "analysis/AnalyticsCube.hpp"
+
+#include <algorithm>
+#include <limits>
+#include <map>
+#include <stdexcept>
+
+#include "utils/Settings.hpp"
+
+namespace MaratonaScore {
+
+namespace {
+
+constexpr uint32_t NO_SOLVER = std::numeric_limits<uint32_t>::max();
+
+void accumulate(CubeAggregate& agg, uint8_t status, int time, int attempts,
+                int timeLimit) {
+    switch (status) {
+        case SOLVED:
+            agg.solved++;
+            agg.wrongBeforeAC += attempts;
+            agg.attemptsHistogram[std::min(
+                attempts, CubeAggregate::ATTEMPT_BUCKETS - 1)]++;
+            if (agg.firstSolveTime < 0 || time < agg.firstSolveTime) {
+                agg.firstSolveTime = time;
+            }
+            break;
+        case UPSOLVED:
+            agg.upsolved++;
+            agg.upsolveLatency += std::max(0, time - timeLimit);
+            break;
+        case ATTEMPTED:
+            agg.attempted++;
+            break;
+        default:
+            break;
+    }
+}
+
+int timeLimitFor(CONTEST_TYPE type) {
+    return type == HOMEWORK ? Settings::getInstance().HOMEWORK_TIME_LIMIT
+                            : Settings::getInstance().CONTEST_TIME_LIMIT;
+}
+
+}  // namespace
+
+double CubeAggregate::solveRate() const {
+    return opportunities ? double(solved) / opportunities : 0.0;
+}
+
+double CubeAggregate::upsolveRate() const {
+    return opportunities ? double(upsolved) / opportunities : 0.0;
+}
+
+double CubeAggregate::meanAttemptsBeforeAC() const {
+    return solved ? double(wrongBeforeAC) / solved : 0.0;
+}
+
+double CubeAggregate::meanUpsolveLatency() const {
+    return upsolved ? double(upsolveLatency) / upsolved : 0.0;
+}
+
+void CubeAggregate::merge(const CubeAggregate& other) {
+    opportunities += other.opportunities;
+    attempted += other.attempted;
+    solved += other.solved;
+    upsolved += other.upsolved;
+    wrongBeforeAC += other.wrongBeforeAC;
+    upsolveLatency += other.upsolveLatency;
+    for (int i = 0; i < ATTEMPT_BUCKETS; i++) {
+        attemptsHistogram[i] += other.attemptsHistogram[i];
+    }
+    if (other.firstSolveTime >= 0 &&
+        (firstSolveTime < 0 || other.firstSolveTime < firstSolveTime)) {
+        firstSolveTime = other.firstSolveTime;
+    }
+}
+
+AnalyticsCube::AnalyticsCube(const std::vector<Contest>& contests) {
+    build(contests);
+}
+
+void AnalyticsCube::build(const std::vector<Contest>& input) {
+    *this = AnalyticsCube();
+
+    for (const Contest& source : input) {
+        if (contestIndex.count(source.getId())) {
+            throw std::invalid_argument("Duplicate contest in cube: " +
+                                        source.getId());
+        }
+        const auto c = static_cast<uint16_t>(contests.size());
+        contestIndex[source.getId()] = c;
+
+        contestIds.push_back(source.getId());
+
+        ContestInfo info;
+        info.type = source.getType();
+        info.participants = static_cast<int>(source.getPerformances().size());
+        info.problemOffset = static_cast<uint32_t>(problemAgg.size());
+
+        const int timeLimit = timeLimitFor(info.type);
+        info.factBegin = cellContest.size();
+        const size_t participationBegin = participations.size();
+
+        // Problem labels are discovered while scanning and remapped to sorted
+        // order once the contest is complete.
+        std::map<std::string, uint16_t> discovered;
+
+        for (const auto& [teamID, performance] : source.getPerformances()) {
+            auto [it, inserted] = contestantIndex.try_emplace(
+                teamID, static_cast<uint32_t>(contestantIds.size()));
+            if (inserted) contestantIds.push_back(teamID);
+            const uint32_t k = it->second;
+
+            Participation part{c, k, {}};
+
+            for (const auto& [problemId, status] : performance.getProblems()) {
+                auto [p, added] = discovered.try_emplace(
+                    problemId, static_cast<uint16_t>(discovered.size()));
+
+                cellContest.push_back(c);
+                cellProblem.push_back(p->second);
+                cellContestant.push_back(k);
+                cellStatus.push_back(static_cast<uint8_t>(status.getStatus()));
+                cellTime.push_back(status.getTimeTaken());
+                cellAttempts.push_back(status.getAttempts());
+
+                accumulate(part.agg, cellStatus.back(), cellTime.back(),
+                           cellAttempts.back(), timeLimit);
+            }
+
+            participations.push_back(part);
+        }
+
+        std::vector<uint16_t> remap(discovered.size());
+        uint16_t sortedIdx = 0;
+        for (const auto& [problemId, firstSeen] : discovered) {
+            remap[firstSeen] = sortedIdx++;
+            info.problems.push_back(problemId);
+        }
+
+        const auto problemCount = static_cast<long long>(info.problems.size());
+        problemAgg.resize(problemAgg.size() + info.problems.size());
+        firstSolver.resize(problemAgg.size(), NO_SOLVER);
+
+        info.factEnd = cellContest.size();
+        for (size_t i = info.factBegin; i < info.factEnd; i++) {
+            cellProblem[i] = remap[cellProblem[i]];
+            const uint32_t slot = info.problemOffset + cellProblem[i];
+            const int before = problemAgg[slot].firstSolveTime;
+            accumulate(problemAgg[slot], cellStatus[i], cellTime[i],
+                       cellAttempts[i], timeLimit);
+            if (problemAgg[slot].firstSolveTime != before) {
+                firstSolver[slot] = cellContestant[i];
+            }
+        }
+
+        CubeAggregate contestTotal;
+        for (size_t p = 0; p < info.problems.size(); p++) {
+            problemAgg[info.problemOffset + p].opportunities = info.participants;
+            contestTotal.merge(problemAgg[info.problemOffset + p]);
+        }
+        for (size_t i = participationBegin; i < participations.size(); i++) {
+            participations[i].agg.opportunities = problemCount;
+        }
+
+        contestAgg.push_back(contestTotal);
+        totalAgg.merge(contestTotal);
+        contests.push_back(std::move(info));
+    }
+
+    // Counting sort participations into contestant-major order.
+    participationOffset.assign(contestantIds.size() + 1, 0);
+    for (const auto& part : participations) {
+        participationOffset[part.contestant + 1]++;
+    }
+    for (size_t k = 0; k < contestantIds.size(); k++) {
+        participationOffset[k + 1] += participationOffset[k];
+    }
+
+    std::vector<Participation> ordered(participations.size());
+    std::vector<uint32_t> cursor(participationOffset.begin(),
+                                 participationOffset.end() - 1);
+    for (const auto& part : participations) {
+        ordered[cursor[part.contestant]++] = part;
+    }
+    participations = std::move(ordered);
+
+    contestantAgg.assign(contestantIds.size(), CubeAggregate());
+    for (const auto& part : participations) {
+        contestantAgg[part.contestant].merge(part.agg);
+    }
+}
+
+const std::vector<std::string>& AnalyticsCube::getContestIds() const {
+    return contestIds;
+}
+
+const std::vector<std::string>& AnalyticsCube::getProblemIds(
+    const std::string& contestId) const {
+    return contests[contestIdx(contestId)].problems;
+}
+
+const std::vector<std::string>& AnalyticsCube::getContestantIds() const {
+    return contestantIds;
+}
+
+const CubeAggregate& AnalyticsCube::total() const { return totalAgg; }
+
+const CubeAggregate& AnalyticsCube::contest(const std::string& contestId) const {
+    return contestAgg[contestIdx(contestId)];
+}
+
+const CubeAggregate& AnalyticsCube::problem(const std::string& contestId,
+                                            const std::string& problemId) const {
+    uint32_t c = contestIdx(contestId);
+    return problemAgg[contests[c].problemOffset + problemIdx(c, problemId)];
+}
+
+const CubeAggregate& AnalyticsCube::contestant(const std::string& teamID) const {
+    return contestantAgg[contestantIdx(teamID)];
+}
+
+CubeAggregate AnalyticsCube::contestantInContest(
+    const std::string& teamID, const std::string& contestId) const {
+    uint32_t k = contestantIdx(teamID);
+    uint32_t c = contestIdx(contestId);
+
+    auto begin = participations.begin() + participationOffset[k];
+    auto end = participations.begin() + participationOffset[k + 1];
+    auto it = std::lower_bound(
+        begin, end, c,
+        [](const Participation& p, uint32_t value) { return p.contest < value; });
+
+    if (it == end || it->contest != c) return CubeAggregate();
+    return it->agg;
+}
+
+CubeAggregate AnalyticsCube::slice(const CubeSlice& s) const {
+    auto typeMatches = [&](uint32_t c) {
+        return !s.type || contests[c].type == *s.type;
+    };
+
+    CubeAggregate result;
+
+    if (s.contestant) {
+        uint32_t k = contestantIdx(*s.contestant);
+
+        if (s.problem) {
+            if (!s.contest) {
+                throw std::invalid_argument(
+                    "Problem slices of a contestant need a contest");
+            }
+            uint32_t c = contestIdx(*s.contest);
+            if (!typeMatches(c)) return result;
+
+            uint16_t p = static_cast<uint16_t>(problemIdx(c, *s.problem));
+            for (size_t i = contests[c].factBegin; i < contests[c].factEnd; i++) {
+                if (cellProblem[i] == p && cellContestant[i] == k) {
+                    accumulate(result, cellStatus[i], cellTime[i],
+                               cellAttempts[i], timeLimitFor(contests[c].type));
+                }
+            }
+            result.opportunities =
+                std::any_of(participations.begin() + participationOffset[k],
+                            participations.begin() + participationOffset[k + 1],
+                            [&](const Participation& part) {
+                                return part.contest == c;
+                            });
+            return result;
+        }
+
+        if (s.contest) {
+            if (!typeMatches(contestIdx(*s.contest))) return result;
+            return contestantInContest(*s.contestant, *s.contest);
+        }
+
+        if (!s.type) return contestantAgg[k];
+
+        for (uint32_t i = participationOffset[k]; i < participationOffset[k + 1];
+             i++) {
+            if (typeMatches(participations[i].contest)) {
+                result.merge(participations[i].agg);
+            }
+        }
+        return result;
+    }
+
+    if (s.contest) {
+        uint32_t c = contestIdx(*s.contest);
+        if (!typeMatches(c)) return result;
+        if (s.problem) {
+            return problemAgg[contests[c].problemOffset + problemIdx(c, *s.problem)];
+        }
+        return contestAgg[c];
+    }
+
+    for (uint32_t c = 0; c < contests.size(); c++) {
+        if (!typeMatches(c)) continue;
+        if (!s.problem) {
+            result.merge(contestAgg[c]);
+            continue;
+        }
+        const auto& problems = contests[c].problems;
+        auto it = std::lower_bound(problems.begin(), problems.end(), *s.problem);
+        if (it != problems.end() && *it == *s.problem) {
+            result.merge(problemAgg[contests[c].problemOffset +
+                                    (it - problems.begin())]);
+        }
+    }
+    return result;
+}
+
+CONTEST_TYPE AnalyticsCube::getContestType(const std::string& contestId) const {
+    return contests[contestIdx(contestId)].type;
+}
+
+int AnalyticsCube::getParticipants(const std::string& contestId) const {
+    return contests[contestIdx(contestId)].participants;
+}
+
+const std::string& AnalyticsCube::getFirstSolver(
+    const std::string& contestId, const std::string& problemId) const {
+    static const std::string none;
+    uint32_t c = contestIdx(contestId);
+    uint32_t solver = firstSolver[contests[c].problemOffset + problemIdx(c, problemId)];
+    return solver == NO_SOLVER ? none : contestantIds[solver];
+}
+
+uint32_t AnalyticsCube::contestIdx(const std::string& contestId) const {
+    auto it = contestIndex.find(contestId);
+    if (it == contestIndex.end()) {
+        throw std::out_of_range("Unknown contest: " + contestId);
+    }
+    return it->second;
+}
+
+uint32_t AnalyticsCube::problemIdx(uint32_t contest,
+                                   const std::string& problemId) const {
+    const auto& problems = contests[contest].problems;
+    auto it = std::lower_bound(problems.begin(), problems.end(), problemId);
+    if (it == problems.end() || *it != problemId) {
+        throw std::out_of_range("Unknown problem " + problemId + " in contest " +
+                                contestIds[contest]);
+    }
+    return static_cast<uint32_t>(it - problems.begin());
+}
+
+uint32_t AnalyticsCube::contestantIdx(const std::string& teamID) const {
+    auto it = contestantIndex.find(teamID);
+    if (it == contestantIndex.end()) {
+        throw std::out_of_range("Unknown contestant: " + teamID);
+    }
+    return it->second;
+}
+
+}  // namespace MaratonaScore
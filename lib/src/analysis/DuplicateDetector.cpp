@@ -0,0 +1,227 @@
+//    Copyright 2025 MaratonaCIn
+//
+//    Licensed under the Apache License, Version 2.0 (the "License");
+//    you may not use this file except in compliance with the License.
+//    You may obtain a copy of the License at
+//
+//        http://www.apache.org/licenses/LICENSE-2.0
+//
+//    Unless required by applicable law or agreed to in writing, software
+//    distributed under the License is distributed on an "AS IS" BASIS,
+//    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//    See the License for the specific language governing permissions and
+//    limitations under the License.
+
+
+#include "analysis/DuplicateDetector.hpp"
+
+#include <algorithm>
+#include <cstdlib>
+#include <limits>
+#include <stdexcept>
+#include <tuple>
+
+#include "utils/StringUtils.hpp"
+
+namespace MaratonaScore {
+
+namespace {
+
+uint64_t mix(uint64_t x) {
+    x += 0x9e3779b97f4a7c15ULL;
+    x = (x ^ (x >> 30)) * 0xbf58476d1ce4e5b9ULL;
+    x = (x ^ (x >> 27)) * 0x94d049bb133111ebULL;
+    return x ^ (x >> 31);
+}
+
+}  // namespace
+
+DuplicateDetector::DuplicateDetector(DuplicateOptions options)
+    : options(options) {
+    if (options.bands < 1 || options.rows < 1) {
+        throw std::invalid_argument("LSH bands and rows must be positive");
+    }
+    if (options.toleranceMinutes < 0) {
+        throw std::invalid_argument("Time tolerance cannot be negative");
+    }
+}
+
+void DuplicateDetector::addContest(const Contest& contest) {
+    const auto round = static_cast<uint32_t>(rounds.size());
+    rounds.push_back(contest.getId());
+
+    for (const auto& [teamID, performance] : contest.getPerformances()) {
+        auto [it, inserted] =
+            teamIndex.try_emplace(teamID, static_cast<uint32_t>(teams.size()));
+        if (inserted) {
+            teams.push_back(teamID);
+            solves.emplace_back();
+        }
+
+        // Problems come sorted from the map, so each timeline stays in
+        // (round, problem) order.
+        for (const auto& [problem, status] : performance.getProblems()) {
+            if (status.getStatus() != SOLVED && status.getStatus() != UPSOLVED) {
+                continue;
+            }
+            solves[it->second].push_back(
+                {round, problem, status.getTimeTaken(), status.getAttempts()});
+        }
+    }
+}
+
+// Each solve yields a token on two time grids of width 2 * tolerance, the
+// second shifted by half a width: solves within the tolerance always share
+// at least one token, whatever side of a grid line they fall on.
+std::vector<uint64_t> DuplicateDetector::signature(
+    const std::vector<Solve>& timeline) const {
+    const int width = std::max(1, 2 * options.toleranceMinutes);
+
+    std::vector<uint64_t> tokens;
+    tokens.reserve(timeline.size() * 2);
+    for (const Solve& solve : timeline) {
+        uint64_t base = mix(fnv1a(solve.problem) ^ mix(solve.round));
+        for (int grid = 0; grid < 2; grid++) {
+            int64_t bucket = (solve.time + grid * (width / 2)) / width;
+            tokens.push_back(mix(base ^ mix(bucket * 2 + grid)));
+        }
+    }
+
+    const size_t length = static_cast<size_t>(options.bands) * options.rows;
+    std::vector<uint64_t> minima(length, std::numeric_limits<uint64_t>::max());
+    for (size_t i = 0; i < length; i++) {
+        const uint64_t seed = mix(i + 1);
+        for (uint64_t token : tokens) {
+            minima[i] = std::min(minima[i], mix(token ^ seed));
+        }
+    }
+    return minima;
+}
+
+bool DuplicateDetector::verify(uint32_t a, uint32_t b,
+                               DuplicatePair& pair) const {
+    const auto& left = solves[a];
+    const auto& right = solves[b];
+
+    pair = {teams[a], teams[b], 0.0, static_cast<int>(left.size()),
+            static_cast<int>(right.size()), {}};
+
+    size_t i = 0, j = 0;
+    while (i < left.size() && j < right.size()) {
+        auto keyLeft = std::tie(left[i].round, left[i].problem);
+        auto keyRight = std::tie(right[j].round, right[j].problem);
+        if (keyLeft < keyRight) {
+            i++;
+        } else if (keyRight < keyLeft) {
+            j++;
+        } else {
+            if (std::abs(left[i].time - right[j].time) <=
+                options.toleranceMinutes) {
+                pair.evidence.push_back({rounds[left[i].round], left[i].problem,
+                                         left[i].time, right[j].time,
+                                         left[i].attempts, right[j].attempts});
+            }
+            i++;
+            j++;
+        }
+    }
+
+    const size_t matching = pair.evidence.size();
+    const size_t either = left.size() + right.size() - matching;
+    pair.similarity =
+        either == 0 ? 0.0 : static_cast<double>(matching) / either;
+    return pair.similarity >= options.threshold;
+}
+
+DuplicateReport DuplicateDetector::detect() const {
+    DuplicateReport report;
+
+    const size_t minSolves = std::max(1, options.minSolves);
+    std::vector<uint32_t> eligible;
+    for (uint32_t t = 0; t < teams.size(); t++) {
+        if (solves[t].size() >= minSolves) eligible.push_back(t);
+    }
+    report.contestants = eligible.size();
+
+    std::vector<std::vector<uint64_t>> signatures;
+    signatures.reserve(eligible.size());
+    for (uint32_t t : eligible) signatures.push_back(signature(solves[t]));
+
+    // Pairs are packed as (lower row << 32 | higher row) and deduplicated
+    // once all bands are in.
+    std::vector<uint64_t> candidates;
+    std::unordered_map<uint64_t, std::vector<uint32_t>> buckets;
+    for (int band = 0; band < options.bands; band++) {
+        buckets.clear();
+        for (uint32_t e = 0; e < eligible.size(); e++) {
+            uint64_t key = mix(static_cast<uint64_t>(band));
+            for (int r = 0; r < options.rows; r++) {
+                key = mix(key ^ signatures[e][band * options.rows + r]);
+            }
+            buckets[key].push_back(eligible[e]);
+        }
+
+        for (const auto& [key, members] : buckets) {
+            if (members.size() < 2) continue;
+            if (members.size() > options.maxBucket) {
+                report.skippedBuckets++;
+                continue;
+            }
+            for (size_t x = 0; x < members.size(); x++) {
+                for (size_t y = x + 1; y < members.size(); y++) {
+                    uint64_t lo = std::min(members[x], members[y]);
+                    uint64_t hi = std::max(members[x], members[y]);
+                    candidates.push_back(lo << 32 | hi);
+                }
+            }
+        }
+    }
+
+    std::sort(candidates.begin(), candidates.end());
+    candidates.erase(std::unique(candidates.begin(), candidates.end()),
+                     candidates.end());
+    report.candidates = candidates.size();
+
+    for (uint64_t packed : candidates) {
+        DuplicatePair pair;
+        if (verify(static_cast<uint32_t>(packed >> 32),
+                   static_cast<uint32_t>(packed), pair)) {
+            report.pairs.push_back(std::move(pair));
+        }
+    }
+
+    std::sort(report.pairs.begin(), report.pairs.end(),
+              [](const DuplicatePair& x, const DuplicatePair& y) {
+                  if (x.similarity != y.similarity) {
+                      return x.similarity > y.similarity;
+                  }
+                  if (x.evidence.size() != y.evidence.size()) {
+                      return x.evidence.size() > y.evidence.size();
+                  }
+                  return std::tie(x.teamA, x.teamB) < std::tie(y.teamA, y.teamB);
+              });
+    return report;
+}
+
+void DuplicateDetector::renderCSV(std::ostream& os,
+                                  const DuplicateReport& report) {
+    os << "Team A,Team B,Similarity,Matching Solves,Solves A,Solves B,"
+          "Evidence\n";
+
+    for (const auto& pair : report.pairs) {
+        os << pair.teamA << "," << pair.teamB << "," << pair.similarity << ","
+           << pair.evidence.size() << "," << pair.solvesA << ","
+           << pair.solvesB << ",";
+        for (size_t i = 0; i < pair.evidence.size(); i++) {
+            const auto& e = pair.evidence[i];
+            os << (i ? ";" : "") << e.contestId << "/" << e.problem << "@"
+               << e.timeA << "~" << e.timeB;
+            if (e.attemptsA != 0 || e.attemptsB != 0) {
+                os << "(-" << e.attemptsA << "/-" << e.attemptsB << ")";
+            }
+        }
+        os << "\n";
+    }
+}
+
+}  // namespace MaratonaScore
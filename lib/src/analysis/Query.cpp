@@ -0,0 +1,986 @@
+//    Copyright 2025 MaratonaCIn
+//
+//    Licensed under the Apache License, Version 2.0 (the "License");
+//    you may not use this file except in compliance with the License.
+//    You may obtain a copy of the License at
+//
+//        http://www.apache.org/licenses/LICENSE-2.0
+//
+//    Unless required by applicable law or agreed to in writing, software
+//    distributed under the License is distributed on an "AS IS" BASIS,
+//    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//    See the License for the specific language governing permissions and
+//    limitations under the License.
+
+#include "analysis/Query.hpp"
+
+#include <algorithm>
+#include <cctype>
+#include <charconv>
+#include <cmath>
+#include <functional>
+#include <limits>
+#include <numeric>
+#include <stdexcept>
+#include <unordered_set>
+
+#include "score/FixedPoint.hpp"
+#include "utils/StringUtils.hpp"
+
+namespace MaratonaScore {
+
+struct Query::Plan {
+    enum class CompareOp { EQ, NE, LT, LE, GT, GE };
+
+    struct Expr {
+        enum Kind { AND, OR, NOT, COMPARE } kind;
+        CompareOp op = CompareOp::EQ;
+        std::string column;  // COMPARE: a column or an aggregate name
+        bool textLiteral = false;
+        double number = 0;
+        std::string text;
+        std::shared_ptr<Expr> left, right;  // NOT only uses left
+    };
+
+    enum class Func { COUNT, COUNT_IF, ANY, ALL, SUM, MIN, MAX, AVG, DISTINCT };
+
+    struct Aggregate {
+        Func func;
+        std::string column;               // SUM .. DISTINCT
+        std::shared_ptr<Expr> condition;  // COUNT_IF, ANY, ALL
+        std::string name;                 // canonical text, its column name
+    };
+
+    struct SortKey {
+        std::string column;
+        bool descending;
+    };
+
+    std::shared_ptr<Expr> where;
+    std::vector<std::string> groupBy;
+    std::shared_ptr<Expr> having;
+    std::vector<std::string> select;
+    std::vector<SortKey> sort;
+    long long limit = -1;
+    std::vector<Aggregate> aggregates;
+    bool grouped = false;
+};
+
+namespace {
+
+using Plan = Query::Plan;
+using Expr = Plan::Expr;
+using CompareOp = Plan::CompareOp;
+using Column = QueryTable::Column;
+
+constexpr size_t BLOCK_SIZE = 4096;
+
+enum RowColumn {
+    COL_SEASON,
+    COL_CONTEST_ID,
+    COL_TYPE,
+    COL_TEAM,
+    COL_RANK,
+    COL_SOLVED,
+    COL_ATTEMPTED,
+    COL_UPSOLVED,
+    COL_PENALTY,
+    COL_BONUS,
+    ROW_COLUMNS
+};
+
+constexpr const char* ROW_COLUMN_NAMES[ROW_COLUMNS] = {
+    "season", "contest",  "type",    "team",    "rank",
+    "solved", "attempted", "upsolved", "penalty", "bonus"};
+
+std::string formatNumber(double value) {
+    if (std::isnan(value)) return "";
+    char buffer[32];
+    auto result = std::to_chars(buffer, buffer + sizeof(buffer), value);
+    return std::string(buffer, result.ptr);
+}
+
+std::string lowercase(std::string text) {
+    for (char& ch : text) {
+        ch = static_cast<char>(std::tolower(static_cast<unsigned char>(ch)));
+    }
+    return text;
+}
+
+// ---------------------------------------------------------------- parsing
+
+struct Token {
+    enum Kind { WORD, NUMBER, STRING, SYMBOL, END } kind;
+    std::string text;
+    double number = 0;
+    size_t position = 0;
+};
+
+[[noreturn]] void syntaxError(const std::string& message, size_t position) {
+    throw std::invalid_argument("Query: " + message + " at position " +
+                                std::to_string(position + 1));
+}
+
+std::vector<Token> tokenize(const std::string& text) {
+    std::vector<Token> tokens;
+    size_t i = 0;
+    while (i < text.size()) {
+        unsigned char ch = static_cast<unsigned char>(text[i]);
+        if (std::isspace(ch)) {
+            i++;
+            continue;
+        }
+
+        Token token{Token::SYMBOL, "", 0, i};
+        if (std::isalpha(ch) || ch == '_') {
+            size_t end = i;
+            while (end < text.size() &&
+                   (std::isalnum(static_cast<unsigned char>(text[end])) ||
+                    text[end] == '_')) {
+                end++;
+            }
+            token.kind = Token::WORD;
+            token.text = text.substr(i, end - i);
+            i = end;
+        } else if (std::isdigit(ch) || ch == '.') {
+            auto result = std::from_chars(text.data() + i,
+                                          text.data() + text.size(),
+                                          token.number);
+            if (result.ec != std::errc()) syntaxError("bad number", i);
+            token.kind = Token::NUMBER;
+            token.text = text.substr(i, result.ptr - (text.data() + i));
+            i = result.ptr - text.data();
+        } else if (ch == '"' || ch == '\'') {
+            size_t end = text.find(static_cast<char>(ch), i + 1);
+            if (end == std::string::npos) syntaxError("unterminated string", i);
+            token.kind = Token::STRING;
+            token.text = text.substr(i + 1, end - i - 1);
+            i = end + 1;
+        } else {
+            static const char* SYMBOLS[] = {"<=", ">=", "!=", "<>", "==", "=",
+                                            "<",  ">",  "(",  ")",  ",",  "-"};
+            for (const char* symbol : SYMBOLS) {
+                if (text.compare(i, std::char_traits<char>::length(symbol),
+                                 symbol) == 0) {
+                    token.text = symbol;
+                    break;
+                }
+            }
+            if (token.text.empty()) {
+                syntaxError(std::string("unexpected '") + text[i] + "'", i);
+            }
+            i += token.text.size();
+        }
+        tokens.push_back(std::move(token));
+    }
+    tokens.push_back({Token::END, "", 0, text.size()});
+    return tokens;
+}
+
+const char* compareText(CompareOp op) {
+    switch (op) {
+        case CompareOp::EQ:
+            return "=";
+        case CompareOp::NE:
+            return "!=";
+        case CompareOp::LT:
+            return "<";
+        case CompareOp::LE:
+            return "<=";
+        case CompareOp::GT:
+            return ">";
+        default:
+            return ">=";
+    }
+}
+
+// Canonical text of a condition; names the aggregates that contain one.
+std::string render(const Expr& e, int parentPrecedence = 0) {
+    switch (e.kind) {
+        case Expr::COMPARE:
+            return e.column + " " + compareText(e.op) + " " +
+                   (e.textLiteral ? "\"" + e.text + "\""
+                                  : formatNumber(e.number));
+        case Expr::NOT:
+            return "not " + render(*e.left, 3);
+        default: {
+            int precedence = e.kind == Expr::AND ? 2 : 1;
+            std::string text = render(*e.left, precedence) +
+                               (e.kind == Expr::AND ? " and " : " or ") +
+                               render(*e.right, precedence);
+            return precedence < parentPrecedence ? "(" + text + ")" : text;
+        }
+    }
+}
+
+class Parser {
+   public:
+    explicit Parser(const std::string& text) : tokens(tokenize(text)) {}
+
+    Plan parse() {
+        Plan plan;
+        if (keyword("where")) plan.where = parseOr(plan, false);
+        if (keyword("group")) {
+            expectKeyword("by");
+            do {
+                plan.groupBy.push_back(columnName());
+            } while (symbol(","));
+        }
+        if (keyword("having")) plan.having = parseOr(plan, true);
+        if (keyword("select")) {
+            do {
+                plan.select.push_back(item(plan));
+            } while (symbol(","));
+        }
+        if (keyword("sort") || keyword("order")) {
+            expectKeyword("by");
+            do {
+                std::string column = item(plan);
+                bool descending = keyword("desc");
+                if (!descending) keyword("asc");
+                plan.sort.push_back({column, descending});
+            } while (symbol(","));
+        }
+        if (keyword("limit")) {
+            const Token& token = current();
+            if (token.kind != Token::NUMBER || token.number < 0 ||
+                token.number != std::floor(token.number)) {
+                syntaxError("limit needs a whole number", token.position);
+            }
+            plan.limit = static_cast<long long>(token.number);
+            next++;
+        }
+        if (current().kind != Token::END) {
+            syntaxError("unexpected '" + current().text + "'",
+                        current().position);
+        }
+
+        plan.grouped = !plan.groupBy.empty() || !plan.aggregates.empty() ||
+                       plan.having;
+        if (plan.grouped && plan.select.empty()) {
+            plan.select = plan.groupBy;
+            plan.select.push_back(
+                addAggregate(plan, {Plan::Func::COUNT, "", nullptr, "count()"}));
+        }
+        return plan;
+    }
+
+   private:
+    std::vector<Token> tokens;
+    size_t next = 0;
+
+    const Token& current() const { return tokens[next]; }
+
+    bool keyword(const char* word) {
+        if (current().kind == Token::WORD && lowercase(current().text) == word) {
+            next++;
+            return true;
+        }
+        return false;
+    }
+
+    void expectKeyword(const char* word) {
+        if (!keyword(word)) {
+            syntaxError(std::string("expected '") + word + "'",
+                        current().position);
+        }
+    }
+
+    bool symbol(const char* text) {
+        if (current().kind == Token::SYMBOL && current().text == text) {
+            next++;
+            return true;
+        }
+        return false;
+    }
+
+    void expectSymbol(const char* text) {
+        if (!symbol(text)) {
+            syntaxError(std::string("expected '") + text + "'",
+                        current().position);
+        }
+    }
+
+    std::string columnName() {
+        if (current().kind != Token::WORD) {
+            syntaxError("expected a column", current().position);
+        }
+        return lowercase(tokens[next++].text);
+    }
+
+    // A column, or an aggregate when followed by '('.
+    std::string item(Plan& plan) {
+        std::string name = columnName();
+        if (symbol("(")) return aggregate(plan, name);
+        return name;
+    }
+
+    static std::string addAggregate(Plan& plan, Plan::Aggregate aggregate) {
+        for (const Plan::Aggregate& existing : plan.aggregates) {
+            if (existing.name == aggregate.name) return existing.name;
+        }
+        plan.aggregates.push_back(aggregate);
+        return aggregate.name;
+    }
+
+    // Called after "<function>(".
+    std::string aggregate(Plan& plan, const std::string& function) {
+        size_t position = tokens[next - 2].position;
+        Plan::Aggregate result{Plan::Func::COUNT, "", nullptr, ""};
+
+        if (function == "count" || function == "any" || function == "all") {
+            if (function == "count" && symbol(")")) {
+                result.name = "count()";
+                return addAggregate(plan, result);
+            }
+            result.func = function == "count" ? Plan::Func::COUNT_IF
+                          : function == "any" ? Plan::Func::ANY
+                                              : Plan::Func::ALL;
+            result.condition = parseOr(plan, false);
+            result.name = function + "(" + render(*result.condition) + ")";
+        } else {
+            static const std::pair<const char*, Plan::Func> COLUMN_FUNCS[] = {
+                {"sum", Plan::Func::SUM},
+                {"min", Plan::Func::MIN},
+                {"max", Plan::Func::MAX},
+                {"avg", Plan::Func::AVG},
+                {"distinct", Plan::Func::DISTINCT}};
+            auto it = std::find_if(
+                std::begin(COLUMN_FUNCS), std::end(COLUMN_FUNCS),
+                [&](const auto& entry) { return function == entry.first; });
+            if (it == std::end(COLUMN_FUNCS)) {
+                syntaxError("unknown aggregate '" + function + "'", position);
+            }
+            result.func = it->second;
+            result.column = columnName();
+            result.name = function + "(" + result.column + ")";
+        }
+        expectSymbol(")");
+        return addAggregate(plan, result);
+    }
+
+    std::shared_ptr<Expr> parseOr(Plan& plan, bool aggregates) {
+        auto left = parseAnd(plan, aggregates);
+        while (keyword("or")) {
+            auto node = std::make_shared<Expr>();
+            node->kind = Expr::OR;
+            node->left = left;
+            node->right = parseAnd(plan, aggregates);
+            left = node;
+        }
+        return left;
+    }
+
+    std::shared_ptr<Expr> parseAnd(Plan& plan, bool aggregates) {
+        auto left = parseNot(plan, aggregates);
+        while (keyword("and")) {
+            auto node = std::make_shared<Expr>();
+            node->kind = Expr::AND;
+            node->left = left;
+            node->right = parseNot(plan, aggregates);
+            left = node;
+        }
+        return left;
+    }
+
+    std::shared_ptr<Expr> parseNot(Plan& plan, bool aggregates) {
+        if (keyword("not")) {
+            auto node = std::make_shared<Expr>();
+            node->kind = Expr::NOT;
+            node->left = parseNot(plan, aggregates);
+            return node;
+        }
+        if (symbol("(")) {
+            auto inner = parseOr(plan, aggregates);
+            expectSymbol(")");
+            return inner;
+        }
+        return parseComparison(plan, aggregates);
+    }
+
+    std::shared_ptr<Expr> parseComparison(Plan& plan, bool aggregates) {
+        auto node = std::make_shared<Expr>();
+        node->kind = Expr::COMPARE;
+
+        size_t position = current().position;
+        node->column = columnName();
+        if (symbol("(")) {
+            if (!aggregates) {
+                syntaxError("aggregates are only allowed in having, select "
+                            "and sort",
+                            position);
+            }
+            node->column = aggregate(plan, node->column);
+        }
+
+        static const std::pair<const char*, CompareOp> OPERATORS[] = {
+            {"=", CompareOp::EQ},  {"==", CompareOp::EQ}, {"!=", CompareOp::NE},
+            {"<>", CompareOp::NE}, {"<", CompareOp::LT},  {"<=", CompareOp::LE},
+            {">", CompareOp::GT},  {">=", CompareOp::GE}};
+        auto it = std::find_if(std::begin(OPERATORS), std::end(OPERATORS),
+                               [&](const auto& entry) {
+                                   return current().kind == Token::SYMBOL &&
+                                          current().text == entry.first;
+                               });
+        if (it == std::end(OPERATORS)) {
+            syntaxError("expected a comparison", current().position);
+        }
+        node->op = it->second;
+        next++;
+
+        bool negative = symbol("-");
+        const Token& literal = current();
+        if (literal.kind == Token::NUMBER) {
+            node->number = negative ? -literal.number : literal.number;
+        } else if (literal.kind == Token::STRING && !negative) {
+            node->textLiteral = true;
+            node->text = literal.text;
+        } else {
+            syntaxError("expected a number or a quoted string",
+                        literal.position);
+        }
+        next++;
+        return node;
+    }
+};
+
+// ------------------------------------------------------------- evaluation
+
+const Column* findColumn(const std::vector<Column>& columns,
+                         const std::string& name) {
+    for (const Column& column : columns) {
+        if (column.name == name) return &column;
+    }
+    return nullptr;
+}
+
+const Column& requireColumn(const std::vector<Column>& columns,
+                            const std::string& name, bool grouped) {
+    const Column* column = findColumn(columns, name);
+    if (column) return *column;
+    if (grouped && std::find(std::begin(ROW_COLUMN_NAMES),
+                             std::end(ROW_COLUMN_NAMES),
+                             name) != std::end(ROW_COLUMN_NAMES)) {
+        throw std::invalid_argument("Query: '" + name +
+                                    "' must be grouped by or aggregated");
+    }
+    throw std::invalid_argument("Query: unknown column '" + name + "'");
+}
+
+// A condition bound to the columns it reads. Text comparisons are decided
+// once per dictionary entry, so every comparison runs as a flat loop.
+struct Bound {
+    Expr::Kind kind;
+    CompareOp op = CompareOp::EQ;
+    const double* numbers = nullptr;
+    double literal = 0;
+    const uint32_t* codes = nullptr;
+    std::vector<uint8_t> truth;
+    std::unique_ptr<Bound> left, right;
+};
+
+template <typename T>
+bool compare(const T& a, const T& b, CompareOp op) {
+    switch (op) {
+        case CompareOp::EQ:
+            return a == b;
+        case CompareOp::NE:
+            return a != b;
+        case CompareOp::LT:
+            return a < b;
+        case CompareOp::LE:
+            return a <= b;
+        case CompareOp::GT:
+            return a > b;
+        default:
+            return a >= b;
+    }
+}
+
+std::unique_ptr<Bound> bindCondition(const Expr& e, const std::vector<Column>& columns,
+                            bool grouped) {
+    auto bound = std::make_unique<Bound>();
+    bound->kind = e.kind;
+    if (e.kind != Expr::COMPARE) {
+        bound->left = bindCondition(*e.left, columns, grouped);
+        if (e.right) bound->right = bindCondition(*e.right, columns, grouped);
+        return bound;
+    }
+
+    const Column& column = requireColumn(columns, e.column, grouped);
+    bound->op = e.op;
+    if (column.text) {
+        // Round IDs order like the season ("2" < "10" < "H1" < "FINALS");
+        // any other text has no order a number could mean.
+        const bool ordering = e.op != CompareOp::EQ && e.op != CompareOp::NE;
+        const bool roundIds = column.name == ROW_COLUMN_NAMES[COL_CONTEST_ID];
+        if (ordering && !roundIds && !e.textLiteral) {
+            throw std::invalid_argument("Query: '" + e.column +
+                                        "' is text, not a number");
+        }
+
+        std::string literal = e.textLiteral ? e.text : formatNumber(e.number);
+        bound->codes = column.codes.data();
+        bound->truth.resize(column.dictionary.size());
+        for (size_t i = 0; i < column.dictionary.size(); ++i) {
+            const std::string& value = column.dictionary[i];
+            if (ordering && roundIds) {
+                int order = contestIdLess(value, literal)   ? -1
+                            : contestIdLess(literal, value) ? 1
+                                                            : 0;
+                bound->truth[i] = compare(order, 0, e.op);
+            } else {
+                bound->truth[i] = compare(value, literal, e.op);
+            }
+        }
+    } else {
+        if (e.textLiteral) {
+            throw std::invalid_argument("Query: '" + e.column +
+                                        "' is a number, not text");
+        }
+        bound->numbers = column.numbers.data();
+        bound->literal = e.number;
+    }
+    return bound;
+}
+
+template <typename Compare>
+void compareBlock(const double* values, double literal, uint8_t* out,
+                  size_t count, Compare cmp) {
+    for (size_t i = 0; i < count; ++i) out[i] = cmp(values[i], literal);
+}
+
+class Evaluator {
+   public:
+    // 1 for every row in [begin, begin + count) that satisfies b.
+    void block(const Bound& b, size_t begin, size_t count, uint8_t* out,
+               size_t depth = 0) {
+        switch (b.kind) {
+            case Expr::COMPARE:
+                if (b.codes) {
+                    const uint32_t* codes = b.codes + begin;
+                    const uint8_t* truth = b.truth.data();
+                    for (size_t i = 0; i < count; ++i) out[i] = truth[codes[i]];
+                } else {
+                    compareNumbers(b, begin, count, out);
+                }
+                break;
+            case Expr::NOT:
+                block(*b.left, begin, count, out, depth);
+                for (size_t i = 0; i < count; ++i) out[i] ^= 1;
+                break;
+            default: {
+                block(*b.left, begin, count, out, depth);
+                uint8_t* other = buffer(depth);
+                block(*b.right, begin, count, other, depth + 1);
+                if (b.kind == Expr::AND) {
+                    for (size_t i = 0; i < count; ++i) out[i] &= other[i];
+                } else {
+                    for (size_t i = 0; i < count; ++i) out[i] |= other[i];
+                }
+            }
+        }
+    }
+
+    std::vector<uint8_t> mask(const Bound& b, size_t rows) {
+        std::vector<uint8_t> result(rows);
+        for (size_t begin = 0; begin < rows; begin += BLOCK_SIZE) {
+            block(b, begin, std::min(BLOCK_SIZE, rows - begin),
+                  result.data() + begin);
+        }
+        return result;
+    }
+
+   private:
+    std::vector<std::vector<uint8_t>> scratch;
+
+    uint8_t* buffer(size_t depth) {
+        if (scratch.size() <= depth) scratch.resize(depth + 1);
+        scratch[depth].resize(BLOCK_SIZE);
+        return scratch[depth].data();
+    }
+
+    static void compareNumbers(const Bound& b, size_t begin, size_t count,
+                               uint8_t* out) {
+        const double* values = b.numbers + begin;
+        switch (b.op) {
+            case CompareOp::EQ:
+                compareBlock(values, b.literal, out, count, std::equal_to<>());
+                break;
+            case CompareOp::NE:
+                compareBlock(values, b.literal, out, count,
+                             std::not_equal_to<>());
+                break;
+            case CompareOp::LT:
+                compareBlock(values, b.literal, out, count, std::less<>());
+                break;
+            case CompareOp::LE:
+                compareBlock(values, b.literal, out, count, std::less_equal<>());
+                break;
+            case CompareOp::GT:
+                compareBlock(values, b.literal, out, count, std::greater<>());
+                break;
+            default:
+                compareBlock(values, b.literal, out, count,
+                             std::greater_equal<>());
+        }
+    }
+};
+
+std::vector<uint32_t> selectRows(const std::vector<uint8_t>* mask,
+                                 size_t rows) {
+    std::vector<uint32_t> selected;
+    if (!mask) {
+        selected.resize(rows);
+        std::iota(selected.begin(), selected.end(), 0u);
+        return selected;
+    }
+    for (size_t i = 0; i < rows; ++i) {
+        if ((*mask)[i]) selected.push_back(static_cast<uint32_t>(i));
+    }
+    return selected;
+}
+
+// Dense code of every selected row's value in column: the dictionary code
+// for text, the index of the distinct value for numbers.
+std::vector<uint32_t> valueCodes(const Column& column,
+                                 const std::vector<uint32_t>& rows) {
+    std::vector<uint32_t> codes(rows.size());
+    if (column.text) {
+        for (size_t k = 0; k < rows.size(); ++k) {
+            codes[k] = column.codes[rows[k]];
+        }
+        return codes;
+    }
+    std::unordered_map<double, uint32_t> index;
+    for (size_t k = 0; k < rows.size(); ++k) {
+        auto [it, inserted] = index.emplace(
+            column.numbers[rows[k]], static_cast<uint32_t>(index.size()));
+        codes[k] = it->second;
+    }
+    return codes;
+}
+
+Column gatherColumn(const Column& source, const std::vector<uint32_t>& rows) {
+    Column column;
+    column.name = source.name;
+    column.text = source.text;
+    if (source.text) {
+        column.dictionary = source.dictionary;
+        column.codes.reserve(rows.size());
+        for (uint32_t row : rows) column.codes.push_back(source.codes[row]);
+    } else {
+        column.numbers.reserve(rows.size());
+        for (uint32_t row : rows) column.numbers.push_back(source.numbers[row]);
+    }
+    return column;
+}
+
+Column aggregateColumn(const Plan::Aggregate& aggregate,
+                       const std::vector<Column>& rowColumns, size_t rowCount,
+                       const std::vector<uint32_t>& rows,
+                       const std::vector<uint32_t>& group, size_t groups,
+                       Evaluator& evaluator) {
+    Column column;
+    column.name = aggregate.name;
+    std::vector<double>& values = column.numbers;
+
+    switch (aggregate.func) {
+        case Plan::Func::COUNT:
+            values.assign(groups, 0);
+            for (uint32_t g : group) values[g] += 1;
+            break;
+        case Plan::Func::COUNT_IF:
+        case Plan::Func::ANY:
+        case Plan::Func::ALL: {
+            auto bound = bindCondition(*aggregate.condition, rowColumns, false);
+            std::vector<uint8_t> mask = evaluator.mask(*bound, rowCount);
+            if (aggregate.func == Plan::Func::COUNT_IF) {
+                values.assign(groups, 0);
+                for (size_t k = 0; k < rows.size(); ++k) {
+                    values[group[k]] += mask[rows[k]];
+                }
+            } else {
+                // Booleans as 1 / 0, so "any(...) = 1" reads naturally.
+                bool all = aggregate.func == Plan::Func::ALL;
+                values.assign(groups, all ? 1 : 0);
+                for (size_t k = 0; k < rows.size(); ++k) {
+                    double v = mask[rows[k]];
+                    double& acc = values[group[k]];
+                    acc = all ? std::min(acc, v) : std::max(acc, v);
+                }
+            }
+            break;
+        }
+        case Plan::Func::DISTINCT: {
+            const Column& source =
+                requireColumn(rowColumns, aggregate.column, false);
+            std::vector<uint32_t> codes = valueCodes(source, rows);
+            std::unordered_set<uint64_t> seen;
+            values.assign(groups, 0);
+            for (size_t k = 0; k < rows.size(); ++k) {
+                if (seen.insert(static_cast<uint64_t>(group[k]) << 32 |
+                                codes[k])
+                        .second) {
+                    values[group[k]] += 1;
+                }
+            }
+            break;
+        }
+        default: {
+            const Column& source =
+                requireColumn(rowColumns, aggregate.column, false);
+            if (source.text) {
+                throw std::invalid_argument("Query: " + aggregate.name +
+                                            " needs a number column");
+            }
+            const double nan = std::numeric_limits<double>::quiet_NaN();
+            std::vector<double> counts(groups, 0);
+            bool sum = aggregate.func == Plan::Func::SUM ||
+                       aggregate.func == Plan::Func::AVG;
+            values.assign(groups, sum ? 0 : nan);
+            for (size_t k = 0; k < rows.size(); ++k) {
+                double v = source.numbers[rows[k]];
+                double& acc = values[group[k]];
+                counts[group[k]] += 1;
+                if (sum) {
+                    acc += v;
+                } else if (std::isnan(acc) ||
+                           (aggregate.func == Plan::Func::MIN ? v < acc
+                                                              : v > acc)) {
+                    acc = v;
+                }
+            }
+            if (aggregate.func == Plan::Func::AVG) {
+                for (size_t g = 0; g < groups; ++g) {
+                    values[g] = counts[g] > 0 ? values[g] / counts[g] : nan;
+                }
+            }
+        }
+    }
+    return column;
+}
+
+void sortRows(std::vector<uint32_t>& rows, const std::vector<Column>& columns,
+              const std::vector<Plan::SortKey>& keys, bool grouped) {
+    struct Key {
+        const Column* column;
+        std::vector<uint32_t> order;  // text: position of each code
+        bool descending;
+    };
+    std::vector<Key> resolved;
+    for (const Plan::SortKey& key : keys) {
+        Key k{&requireColumn(columns, key.column, grouped), {}, key.descending};
+        if (k.column->text) {
+            const auto& dictionary = k.column->dictionary;
+            std::vector<uint32_t> codes(dictionary.size());
+            std::iota(codes.begin(), codes.end(), 0u);
+            std::sort(codes.begin(), codes.end(), [&](uint32_t a, uint32_t b) {
+                return dictionary[a] < dictionary[b];
+            });
+            k.order.resize(codes.size());
+            for (size_t i = 0; i < codes.size(); ++i) {
+                k.order[codes[i]] = static_cast<uint32_t>(i);
+            }
+        }
+        resolved.push_back(std::move(k));
+    }
+
+    std::stable_sort(rows.begin(), rows.end(), [&](uint32_t a, uint32_t b) {
+        for (const Key& key : resolved) {
+            int cmp;
+            if (key.column->text) {
+                uint32_t x = key.order[key.column->codes[a]];
+                uint32_t y = key.order[key.column->codes[b]];
+                cmp = x < y ? -1 : x > y ? 1 : 0;
+            } else {
+                double x = key.column->numbers[a];
+                double y = key.column->numbers[b];
+                cmp = x < y ? -1 : x > y ? 1 : 0;
+            }
+            if (cmp != 0) return key.descending ? cmp > 0 : cmp < 0;
+        }
+        return false;
+    });
+}
+
+}  // namespace
+
+void QueryTable::Column::addText(const std::string& value) {
+    auto [it, inserted] =
+        lookup.emplace(value, static_cast<uint32_t>(dictionary.size()));
+    if (inserted) dictionary.push_back(value);
+    codes.push_back(it->second);
+}
+
+QueryTable::QueryTable() : columns(ROW_COLUMNS) {
+    for (int c = 0; c < ROW_COLUMNS; ++c) {
+        columns[c].name = ROW_COLUMN_NAMES[c];
+        columns[c].text = c <= COL_TEAM;
+    }
+}
+
+void QueryTable::addSeason(const std::string& season,
+                           const std::vector<Contest>& contests) {
+    for (const Contest& contest : contests) {
+        std::vector<std::pair<const std::string*, const Performance*>> order;
+        for (const auto& [teamID, performance] : contest.getPerformances()) {
+            order.emplace_back(&teamID, &performance);
+        }
+        std::stable_sort(order.begin(), order.end(),
+                         [](const auto& a, const auto& b) {
+                             return a.second->getRank() < b.second->getRank();
+                         });
+
+        const char* type = contest.getType() == HOMEWORK ? "homework"
+                                                         : "contest";
+        for (const auto& [teamID, performance] : order) {
+            columns[COL_SEASON].addText(season);
+            columns[COL_CONTEST_ID].addText(contest.getId());
+            columns[COL_TYPE].addText(type);
+            columns[COL_TEAM].addText(*teamID);
+            columns[COL_RANK].numbers.push_back(performance->getRank());
+            columns[COL_SOLVED].numbers.push_back(performance->getProblemsSolved());
+            columns[COL_ATTEMPTED].numbers.push_back(
+                performance->getProblemsAttempted());
+            columns[COL_UPSOLVED].numbers.push_back(
+                performance->getProblemsUpsolved());
+            columns[COL_PENALTY].numbers.push_back(performance->getPenalty());
+            columns[COL_BONUS].numbers.push_back(
+                toDouble(performance->getBonusScore()));
+        }
+        rows += order.size();
+    }
+}
+
+size_t QueryTable::size() const { return rows; }
+
+const std::vector<QueryTable::Column>& QueryTable::getColumns() const {
+    return columns;
+}
+
+void QueryResult::renderCSV(std::ostream& os) const {
+    auto field = [&os](const std::string& value) {
+        if (value.find_first_of(",\"\n") == std::string::npos) {
+            os << value;
+            return;
+        }
+        os << '"';
+        for (char ch : value) {
+            if (ch == '"') os << '"';
+            os << ch;
+        }
+        os << '"';
+    };
+    auto line = [&](const std::vector<std::string>& values) {
+        for (size_t i = 0; i < values.size(); ++i) {
+            if (i > 0) os << ',';
+            field(values[i]);
+        }
+        os << '\n';
+    };
+
+    line(columns);
+    for (const auto& row : rows) line(row);
+}
+
+Query Query::parse(const std::string& text) {
+    Query query;
+    query.plan = std::make_shared<const Plan>(Parser(text).parse());
+    return query;
+}
+
+QueryResult Query::run(const QueryTable& table) const {
+    const std::vector<Column>& rowColumns = table.getColumns();
+    Evaluator evaluator;
+
+    std::vector<uint8_t> whereMask;
+    if (plan->where) {
+        whereMask = evaluator.mask(*bindCondition(*plan->where, rowColumns, false),
+                                   table.size());
+    }
+    std::vector<uint32_t> rows =
+        selectRows(plan->where ? &whereMask : nullptr, table.size());
+
+    // Output table: the rows themselves, or one row per group.
+    std::vector<Column> grouped;
+    const std::vector<Column>* columns = &rowColumns;
+
+    if (plan->grouped) {
+        // Group ids are refined one column at a time, in order of first
+        // appearance. Without group by, everything is one group.
+        std::vector<uint32_t> group(rows.size(), 0);
+        size_t groups = 1;
+        for (const std::string& name : plan->groupBy) {
+            std::vector<uint32_t> codes =
+                valueCodes(requireColumn(rowColumns, name, false), rows);
+            std::unordered_map<uint64_t, uint32_t> ids;
+            for (size_t k = 0; k < rows.size(); ++k) {
+                uint64_t key = static_cast<uint64_t>(group[k]) << 32 | codes[k];
+                group[k] = ids.emplace(key, static_cast<uint32_t>(ids.size()))
+                               .first->second;
+            }
+            groups = ids.size();
+        }
+
+        std::vector<uint32_t> firstRow(groups, 0);
+        std::vector<uint8_t> seen(groups, 0);
+        for (size_t k = 0; k < rows.size(); ++k) {
+            if (!seen[group[k]]) {
+                seen[group[k]] = 1;
+                firstRow[group[k]] = rows[k];
+            }
+        }
+
+        for (const std::string& name : plan->groupBy) {
+            grouped.push_back(
+                gatherColumn(requireColumn(rowColumns, name, false), firstRow));
+        }
+        for (const Plan::Aggregate& aggregate : plan->aggregates) {
+            grouped.push_back(aggregateColumn(aggregate, rowColumns,
+                                              table.size(), rows, group,
+                                              groups, evaluator));
+        }
+
+        columns = &grouped;
+        rows.resize(groups);
+        std::iota(rows.begin(), rows.end(), 0u);
+
+        if (plan->having) {
+            std::vector<uint8_t> mask =
+                evaluator.mask(*bindCondition(*plan->having, grouped, true), groups);
+            rows = selectRows(&mask, groups);
+        }
+    }
+
+    sortRows(rows, *columns, plan->sort, plan->grouped);
+    if (plan->limit >= 0 && rows.size() > static_cast<size_t>(plan->limit)) {
+        rows.resize(static_cast<size_t>(plan->limit));
+    }
+
+    std::vector<const Column*> output;
+    if (plan->select.empty()) {
+        for (const Column& column : *columns) output.push_back(&column);
+    } else {
+        for (const std::string& name : plan->select) {
+            output.push_back(&requireColumn(*columns, name, plan->grouped));
+        }
+    }
+
+    QueryResult result;
+    for (const Column* column : output) result.columns.push_back(column->name);
+    result.rows.reserve(rows.size());
+    for (uint32_t row : rows) {
+        std::vector<std::string> values;
+        values.reserve(output.size());
+        for (const Column* column : output) {
+            values.push_back(column->text
+                                 ? column->dictionary[column->codes[row]]
+                                 : formatNumber(column->numbers[row]));
+        }
+        result.rows.push_back(std::move(values));
+    }
+    return result;
+}
+
+}  // namespace MaratonaScore
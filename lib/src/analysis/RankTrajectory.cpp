@@ -0,0 +1,120 @@
+//    Copyright 2025 MaratonaCIn
+//
+//    Licensed under the Apache License, Version 2.0 (the "License");
+//    you may not use this file except in compliance with the License.
+//    You may obtain a copy of the License at
+//
+//        http://www.apache.org/licenses/LICENSE-2.0
+//
+//    Unless required by applicable law or agreed to in writing, software
+//    distributed under the License is distributed on an "AS IS" BASIS,
+//    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//    See the License for the specific language governing permissions and
+//    limitations under the License.
+
+
+#include "analysis/RankTrajectory.hpp"
+
+#include <algorithm>
+
+#include "utils/Blacklist.hpp"
+
+namespace MaratonaScore {
+
+void RankTrajectory::addContest(const Contest& contest, int index) {
+    board.addContest(contest, index);
+    step++;
+    contestId = contest.getId();
+
+    for (Standing* standing : {&raw, &adjusted}) {
+        standing->scores.resize(board.size(), 0);
+        standing->ranks.resize(board.size(), 0);
+    }
+
+    std::vector<uint32_t> changed;
+    for (const auto& [teamID, performance] : contest.getPerformances()) {
+        if (Blacklist::isBlacklisted(teamID)) continue;
+
+        uint32_t row = board.getRow(teamID);
+        raw.scores[row] = board.getTotals(row).total();
+        adjusted.scores[row] = raw.scores[row] - board.getDroppedScore(row);
+        changed.push_back(row);
+    }
+
+    std::vector<uint32_t> changedAdjusted(changed);
+    rerank(raw, changed);
+    rerank(adjusted, changedAdjusted);
+}
+
+void RankTrajectory::rerank(Standing& standing, std::vector<uint32_t>& changed) {
+    // Same order as the scoreboard: score descending, then team ID
+    auto before = [&](uint32_t a, uint32_t b) {
+        if (standing.scores[a] != standing.scores[b]) {
+            return standing.scores[a] > standing.scores[b];
+        }
+        return board.getTeamID(a) < board.getTeamID(b);
+    };
+
+    std::sort(changed.begin(), changed.end(), before);
+
+    // Rows of this round leave their old place
+    std::vector<char> moved(board.size(), 0);
+    for (uint32_t row : changed) moved[row] = 1;
+
+    std::vector<uint32_t> kept;
+    kept.reserve(standing.order.size());
+    for (uint32_t row : standing.order) {
+        if (!moved[row]) kept.push_back(row);
+    }
+
+    standing.order.resize(kept.size() + changed.size());
+    std::merge(kept.begin(), kept.end(), changed.begin(), changed.end(),
+               standing.order.begin(), before);
+
+    for (size_t i = 0; i < standing.order.size(); i++) {
+        standing.ranks[standing.order[i]] = static_cast<int>(i) + 1;
+    }
+}
+
+int RankTrajectory::getStep() const {
+    return step;
+}
+
+const std::string& RankTrajectory::getContestId() const {
+    return contestId;
+}
+
+size_t RankTrajectory::size() const {
+    return board.size();
+}
+
+const std::string& RankTrajectory::getTeamID(uint32_t row) const {
+    return board.getTeamID(row);
+}
+
+ScoreValue RankTrajectory::getScore(uint32_t row, bool adjusted) const {
+    return (adjusted ? this->adjusted : raw).scores.at(row);
+}
+
+int RankTrajectory::getRank(uint32_t row, bool adjusted) const {
+    return (adjusted ? this->adjusted : raw).ranks.at(row);
+}
+
+const std::vector<uint32_t>& RankTrajectory::getRanking(bool adjusted) const {
+    return (adjusted ? this->adjusted : raw).order;
+}
+
+void RankTrajectory::renderHeader(std::ostream& os) {
+    os << "Step,Contest,Team ID,Score,Rank,Adjusted Score,Adjusted Rank\n";
+}
+
+void RankTrajectory::renderStep(std::ostream& os) const {
+    for (uint32_t row : raw.order) {
+        os << step << ',' << contestId << ',' << board.getTeamID(row) << ','
+           << toDouble(raw.scores[row]) << ',' << raw.ranks[row] << ','
+           << toDouble(adjusted.scores[row]) << ',' << adjusted.ranks[row]
+           << '\n';
+    }
+}
+
+}  // namespace MaratonaScore
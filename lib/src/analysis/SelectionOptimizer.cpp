@@ -0,0 +1,394 @@
+//    Copyright 2025 MaratonaCIn
+//
+//    Licensed under the Apache License, Version 2.0 (the "License");
+//    you may not use this file except in compliance with the License.
+//    You may obtain a copy of the License at
+//
+//        http://www.apache.org/licenses/LICENSE-2.0
+//
+//    Unless required by applicable law or agreed to in writing, software
+//    distributed under the License is distributed on an "AS IS" BASIS,
+//    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//    See the License for the specific language governing permissions and
+//    limitations under the License.
+
+
+#include "analysis/SelectionOptimizer.hpp"
+
+#include <yaml-cpp/yaml.h>
+
+#include <algorithm>
+#include <iostream>
+#include <limits>
+#include <map>
+#include <optional>
+#include <stdexcept>
+#include <unordered_map>
+
+namespace MaratonaScore {
+
+namespace {
+
+std::vector<std::string> readList(const YAML::Node& node) {
+    std::vector<std::string> values;
+    if (node) {
+        for (const auto& value : node) values.push_back(value.as<std::string>());
+    }
+    return values;
+}
+
+// Depth-first search that picks the next selected candidate at each level,
+// so the recursion is only `size` deep however many candidates there are.
+struct Search {
+    int n = 0;
+    const std::vector<ScoreValue>* score = nullptr;
+    std::vector<ScoreValue> prefix;      // prefix[i] = sum of score[0..i)
+    std::vector<char> required;
+    std::vector<int> nextRequired;       // first required index >= i
+    std::vector<uint32_t> groupOffset;   // CSR: groups of each candidate
+    std::vector<int> groupIndex;
+    std::vector<int> groupMin;
+    std::vector<int> groupMax;
+    std::vector<std::vector<int>> positions;  // members of min groups
+    std::vector<std::vector<ScoreValue>> memberPrefix;
+    std::vector<int> count;
+    std::vector<int> twin;      // earlier interchangeable candidate, or -1
+    std::vector<int> capGroup;  // first capped group of each candidate, or -1
+    std::vector<int> extra;     // scratch for bound()
+    std::vector<int> touched;
+    std::vector<ScoreValue> greedy;
+
+    std::vector<int> chosen;
+    std::vector<int> best;
+    ScoreValue bestScore = std::numeric_limits<ScoreValue>::min();
+    bool found = false;
+    uint64_t nodes = 0;
+
+    int membersFrom(int group, int index) const {
+        const std::vector<int>& members = positions[group];
+        return static_cast<int>(
+            members.end() -
+            std::lower_bound(members.begin(), members.end(), index));
+    }
+
+    // Upper bound for picking `slots` more candidates from `index` on, or
+    // nullopt if not even the relaxation can fill them. Keeping a single
+    // capped group per candidate turns the caps into a partition, where the
+    // greedy picks are the best for every count at once. A group still short
+    // of its minimum needs its best remaining members plus that many fewer
+    // of the greedy picks.
+    std::optional<ScoreValue> bound(int index, int slots) {
+        greedy.assign(1, 0);
+        for (int i = index; i < n && static_cast<int>(greedy.size()) <= slots;
+             i++) {
+            int g = capGroup[i];
+            if (g >= 0) {
+                if (count[g] + extra[g] >= groupMax[g]) continue;
+                if (extra[g]++ == 0) touched.push_back(g);
+            }
+            greedy.push_back(greedy.back() + (*score)[i]);
+        }
+        for (int g : touched) extra[g] = 0;
+        touched.clear();
+        if (static_cast<int>(greedy.size()) <= slots) return std::nullopt;
+
+        ScoreValue top = greedy[slots];
+        for (size_t g = 0; g < groupMin.size(); g++) {
+            int deficit = groupMin[g] - count[g];
+            if (deficit <= 0) continue;
+
+            const std::vector<int>& members = positions[g];
+            size_t first = std::lower_bound(members.begin(), members.end(),
+                                            index) -
+                           members.begin();
+            ScoreValue forced =
+                memberPrefix[g][first + deficit] - memberPrefix[g][first];
+            top = std::min(top, forced + greedy[slots - deficit]);
+        }
+
+        return top;
+    }
+
+    bool canInclude(int index) const {
+        for (uint32_t k = groupOffset[index]; k < groupOffset[index + 1]; k++) {
+            int g = groupIndex[k];
+            if (groupMax[g] >= 0 && count[g] >= groupMax[g]) return false;
+        }
+        return true;
+    }
+
+    void run(int start, int slots, ScoreValue current) {
+        nodes++;
+
+        for (size_t g = 0; g < groupMin.size(); g++) {
+            if (groupMin[g] - count[g] > slots) return;
+        }
+
+        if (slots == 0) {
+            if (nextRequired[start] < n) return;
+            if (!found || current > bestScore) {
+                found = true;
+                bestScore = current;
+                best = chosen;
+            }
+            return;
+        }
+
+        for (int j = start; j + slots <= n; j++) {
+            // Skipping start..j-1 must leave enough members of each group
+            bool enough = true;
+            for (size_t g = 0; g < groupMin.size() && enough; g++) {
+                enough = groupMin[g] - count[g] <= membersFrom(g, j);
+            }
+            if (!enough) break;
+
+            // A twin tried at this level already covered these selections
+            if (twin[j] < start && canInclude(j)) {
+                // Scores are sorted, so the bound only shrinks as j grows
+                std::optional<ScoreValue> top = bound(j, slots);
+                if (!top || (found && current + *top <= bestScore)) break;
+
+                for (uint32_t k = groupOffset[j]; k < groupOffset[j + 1]; k++) {
+                    count[groupIndex[k]]++;
+                }
+                chosen.push_back(j);
+
+                run(j + 1, slots - 1, current + (*score)[j]);
+
+                chosen.pop_back();
+                for (uint32_t k = groupOffset[j]; k < groupOffset[j + 1]; k++) {
+                    count[groupIndex[k]]--;
+                }
+            }
+
+            if (required[j]) break;  // cannot be skipped
+        }
+    }
+};
+
+}  // namespace
+
+SelectionConstraints SelectionConstraints::loadFromFile(
+    const std::string& filename) {
+    SelectionConstraints constraints;
+
+    YAML::Node config = YAML::LoadFile(filename)["selection"];
+    if (!config) {
+        throw std::runtime_error("Missing 'selection' section in " + filename);
+    }
+
+    if (config["size"]) constraints.size = config["size"].as<int>();
+    if (config["min_contests"]) {
+        constraints.minContests = config["min_contests"].as<int>();
+    }
+    if (config["min_homeworks"]) {
+        constraints.minHomeworks = config["min_homeworks"].as<int>();
+    }
+    constraints.required = readList(config["required"]);
+    constraints.excluded = readList(config["excluded"]);
+
+    if (config["groups"]) {
+        for (const auto& node : config["groups"]) {
+            SelectionGroup group;
+            group.name = node["name"] ? node["name"].as<std::string>() : "";
+            group.members = readList(node["members"]);
+            if (node["min"]) group.min = node["min"].as<int>();
+            if (node["max"]) group.max = node["max"].as<int>();
+            constraints.groups.push_back(std::move(group));
+        }
+    }
+
+    if (constraints.size < 0) {
+        throw std::invalid_argument("Selection size must not be negative");
+    }
+
+    return constraints;
+}
+
+SelectionOptimizer::SelectionOptimizer(const Scoreboard& scoreboard) {
+    int rank = 1;
+    for (const auto& [teamID, contestant] : scoreboard.getRanking()) {
+        Candidate candidate{teamID, rank++, contestant->getTotalScoreFixed(),
+                            0, 0};
+
+        for (const auto& [id, contestScore] : contestant->getContestScores()) {
+            if (contestScore.type == HOMEWORK) {
+                candidate.homeworks++;
+            } else if (id != "FINALS") {
+                candidate.contests++;
+            }
+        }
+
+        candidates.push_back(std::move(candidate));
+    }
+}
+
+SelectionResult SelectionOptimizer::solve(
+    const SelectionConstraints& constraints) const {
+    SelectionResult result;
+
+    std::unordered_map<std::string, int> position;
+    for (size_t i = 0; i < candidates.size(); i++) {
+        position.emplace(candidates[i].teamID, static_cast<int>(i));
+    }
+
+    std::vector<char> excluded(candidates.size(), 0);
+    for (const std::string& teamID : constraints.excluded) {
+        auto it = position.find(teamID);
+        if (it != position.end()) excluded[it->second] = 1;
+    }
+
+    // Eligible candidates, still in ranking order
+    std::vector<int> eligible;
+    std::vector<int> eligibleIndex(candidates.size(), -1);
+    for (size_t i = 0; i < candidates.size(); i++) {
+        const Candidate& c = candidates[i];
+        if (excluded[i] || c.contests < constraints.minContests ||
+            c.homeworks < constraints.minHomeworks) {
+            continue;
+        }
+        eligibleIndex[i] = static_cast<int>(eligible.size());
+        eligible.push_back(static_cast<int>(i));
+    }
+
+    Search search;
+    search.n = static_cast<int>(eligible.size());
+
+    std::vector<ScoreValue> scores(search.n);
+    search.prefix.assign(search.n + 1, 0);
+    for (int i = 0; i < search.n; i++) {
+        scores[i] = candidates[eligible[i]].score;
+        search.prefix[i + 1] = search.prefix[i] + scores[i];
+    }
+    search.score = &scores;
+
+    search.required.assign(search.n, 0);
+    for (const std::string& teamID : constraints.required) {
+        auto it = position.find(teamID);
+        if (it == position.end()) {
+            throw std::invalid_argument("Unknown required team: " + teamID);
+        }
+        if (eligibleIndex[it->second] < 0) {
+            std::cerr << "[WARNING] Required team " << teamID
+                      << " is excluded or below the participation minimums\n";
+            return result;
+        }
+        search.required[eligibleIndex[it->second]] = 1;
+    }
+
+    search.nextRequired.assign(search.n + 1, search.n);
+    for (int i = search.n - 1; i >= 0; i--) {
+        search.nextRequired[i] =
+            search.required[i] ? i : search.nextRequired[i + 1];
+    }
+
+    // Groups of each eligible candidate (CSR). Groups with a minimum come
+    // first so that groupMin lines up with their indices.
+    std::vector<const SelectionGroup*> groups;
+    for (const SelectionGroup& group : constraints.groups) {
+        if (group.min > 0) groups.push_back(&group);
+    }
+    for (const SelectionGroup& group : constraints.groups) {
+        if (group.min <= 0) groups.push_back(&group);
+    }
+
+    std::vector<std::vector<int>> groupsOf(search.n);
+    for (size_t g = 0; g < groups.size(); g++) {
+        std::vector<int> members;
+
+        for (const std::string& teamID : groups[g]->members) {
+            auto it = position.find(teamID);
+            if (it == position.end()) {
+                std::cerr << "[WARNING] Unknown team in group "
+                          << groups[g]->name << ": " << teamID << '\n';
+                continue;
+            }
+            int index = eligibleIndex[it->second];
+            if (index >= 0) members.push_back(index);
+        }
+
+        std::sort(members.begin(), members.end());
+        members.erase(std::unique(members.begin(), members.end()),
+                      members.end());
+
+        for (int index : members) groupsOf[index].push_back(static_cast<int>(g));
+        search.groupMax.push_back(groups[g]->max);
+        if (groups[g]->min > 0) {
+            std::vector<ScoreValue> memberPrefix(1, 0);
+            for (int index : members) {
+                memberPrefix.push_back(memberPrefix.back() + scores[index]);
+            }
+            search.groupMin.push_back(groups[g]->min);
+            search.positions.push_back(std::move(members));
+            search.memberPrefix.push_back(std::move(memberPrefix));
+        }
+    }
+    search.count.assign(groups.size(), 0);
+    search.extra.assign(groups.size(), 0);
+
+    // Same score, same groups and not required: swapping two such
+    // candidates changes neither the total nor feasibility
+    search.twin.assign(search.n, -1);
+    std::map<std::vector<int>, int> lastWithGroups;
+    for (int i = 0; i < search.n; i++) {
+        if (i > 0 && scores[i] != scores[i - 1]) lastWithGroups.clear();
+        if (search.required[i]) continue;
+
+        auto [it, inserted] = lastWithGroups.emplace(groupsOf[i], i);
+        if (!inserted) {
+            search.twin[i] = it->second;
+            it->second = i;
+        }
+    }
+
+    search.capGroup.assign(search.n, -1);
+    for (int i = 0; i < search.n; i++) {
+        for (int g : groupsOf[i]) {
+            if (groups[g]->max >= 0) {
+                search.capGroup[i] = g;
+                break;
+            }
+        }
+    }
+
+    search.groupOffset.assign(search.n + 1, 0);
+    for (int i = 0; i < search.n; i++) {
+        for (int g : groupsOf[i]) search.groupIndex.push_back(g);
+        search.groupOffset[i + 1] =
+            static_cast<uint32_t>(search.groupIndex.size());
+    }
+
+    int size = constraints.size;
+    if (size > search.n) {
+        std::cerr << "[WARNING] Only " << search.n
+                  << " eligible teams, selecting all of them\n";
+        size = search.n;
+    }
+
+    search.run(0, size, 0);
+
+    result.nodes = search.nodes;
+    if (!search.found) return result;
+
+    result.feasible = true;
+    result.totalScore = search.bestScore;
+    for (int index : search.best) {
+        const Candidate& c = candidates[eligible[index]];
+        result.selected.push_back({c.teamID, c.rank, c.score});
+    }
+
+    return result;
+}
+
+void SelectionOptimizer::renderCSV(std::ostream& os,
+                                   const SelectionResult& result) {
+    os << "Selection,Rank,Team ID,Overall Score\n";
+
+    int selection = 1;
+    for (const SelectedTeam& team : result.selected) {
+        os << selection++ << ',' << team.rank << ',' << team.teamID << ','
+           << toDouble(team.score) << '\n';
+    }
+}
+
+}  // namespace MaratonaScore
@@ -0,0 +1,284 @@
+//    Copyright 2025 MaratonaCIn
+//
+//    Licensed under the Apache License, Version 2.0 (the "License");
+//    you may not use this file except in compliance with the License.
+//    You may obtain a copy of the License at
+//
+//        http://www.apache.org/licenses/LICENSE-2.0
+//
+//    Unless required by applicable law or agreed to in writing, software
+//    distributed under the License is distributed on an "AS IS" BASIS,
+//    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//    See the License for the specific language governing permissions and
+//    limitations under the License.
+
+#include "analysis/SelectionSimulator.hpp"
+
+#include <algorithm>
+#include <numeric>
+#include <random>
+#include <set>
+#include <stdexcept>
+#include <thread>
+
+#include "score/ScoringPolicy.hpp"
+#include "utils/Blacklist.hpp"
+#include "utils/Settings.hpp"
+#include "utils/StringUtils.hpp"
+
+namespace MaratonaScore {
+
+namespace {
+
+struct WorkerCounts {
+    std::vector<uint64_t> selected;
+    std::vector<uint64_t> rankSum;
+    std::vector<double> scoreSum;
+    std::vector<uint32_t> histogram;
+
+    WorkerCounts(size_t n, int buckets)
+        : selected(n), rankSum(n), scoreSum(n), histogram(n * buckets) {}
+};
+
+}  // namespace
+
+SelectionSimulator::SelectionSimulator(const Scoreboard& scoreboard) {
+    const Settings& settings = Settings::getInstance();
+    contestSlots = settings.NUMBER_OF_CONTESTS;
+    dropWorst = std::clamp(settings.IGNORE_WORST_CONTESTS, 0, contestSlots);
+
+    withScoringPolicy([&](auto policy) {
+        for (int j = 0; j <= contestSlots; j++) {
+            contestWeights.push_back(
+                toDouble(decltype(policy)::problemValue(CONTEST, j)));
+            homeworkWeights.push_back(
+                toDouble(decltype(policy)::problemValue(HOMEWORK, j)));
+        }
+    });
+
+    std::vector<const Contestant*> contestants;
+    std::set<int> playedContests;
+    std::set<int> playedHomeworks;
+
+    for (const auto& [teamID, contestant] : scoreboard.getContestants()) {
+        if (Blacklist::isBlacklisted(teamID)) continue;
+
+        teamIDs.push_back(teamID);
+        contestants.push_back(&contestant);
+
+        for (const auto& [contestId, score] : contestant.getContestScores()) {
+            int slot = contestSlot(contestId, "", contestSlots);
+            if (slot >= 0) playedContests.insert(slot);
+            slot = contestSlot(contestId, "H", contestSlots);
+            if (slot >= 0) playedHomeworks.insert(slot);
+            if (contestId == "FINALS") finalsPlayed = true;
+        }
+    }
+
+    for (int j = 0; j < contestSlots; j++) {
+        if (!playedContests.count(j)) remainingContests.push_back(j);
+        if (!playedHomeworks.count(j)) remainingHomeworks.push_back(j);
+    }
+
+    const size_t n = contestants.size();
+    playedSlots.assign(n * contestSlots, 0.0);
+    contestSampleOffset.push_back(0);
+    homeworkSampleOffset.push_back(0);
+
+    for (size_t k = 0; k < n; k++) {
+        const auto& scores = contestants[k]->getContestScores();
+        double fixed = 0.0;
+
+        for (const auto& [contestId, score] : scores) {
+            int slot = contestSlot(contestId, "", contestSlots);
+            if (slot >= 0) {
+                playedSlots[k * contestSlots + slot] = toDouble(score.total());
+                fixed += toDouble(score.upsolve);
+            } else {
+                fixed += toDouble(score.total() + score.upsolve);
+            }
+        }
+
+        // Rounds a contestant skipped are part of their distribution as zeros.
+        for (int slot : playedContests) {
+            auto it = scores.find(std::to_string(slot + 1));
+            contestSamples.push_back(
+                it == scores.end()
+                    ? Sample{0.0, 0.0, 0.0}
+                    : Sample{toDouble(it->second.solve) / contestWeights[slot],
+                             toDouble(it->second.bonus),
+                             toDouble(it->second.upsolve)});
+        }
+        for (int slot : playedHomeworks) {
+            auto it = scores.find("H" + std::to_string(slot + 1));
+            homeworkSamples.push_back(
+                it == scores.end()
+                    ? Sample{0.0, 0.0, 0.0}
+                    : Sample{toDouble(it->second.solve) / homeworkWeights[slot],
+                             toDouble(it->second.bonus),
+                             toDouble(it->second.upsolve)});
+        }
+
+        contestSampleOffset.push_back(
+            static_cast<uint32_t>(contestSamples.size()));
+        homeworkSampleOffset.push_back(
+            static_cast<uint32_t>(homeworkSamples.size()));
+        fixedScores.push_back(fixed);
+        currentScores.push_back(contestants[k]->getTotalScore());
+    }
+}
+
+std::vector<ContestantProjection> SelectionSimulator::simulate(
+    const SimulationOptions& options) const {
+    if (options.iterations <= 0 || options.rankBuckets <= 0) {
+        throw std::invalid_argument(
+            "Simulation needs positive iterations and rank buckets");
+    }
+
+    const size_t n = teamIDs.size();
+    const int buckets = options.rankBuckets;
+    const int threads = std::max(
+        1, options.threads > 0 ? options.threads
+                               : static_cast<int>(std::thread::hardware_concurrency()));
+    const bool simulateFinals = options.includeFinals && !finalsPlayed;
+
+    auto worker = [&](int iterations, uint32_t stream, WorkerCounts& counts) {
+        std::seed_seq seq{static_cast<uint32_t>(options.seed),
+                          static_cast<uint32_t>(options.seed >> 32), stream};
+        std::mt19937_64 rng(seq);
+
+        // Multiply-shift instead of uniform_int_distribution: pools are tiny,
+        // so the bias is negligible and the draw stays a single RNG call.
+        auto draw = [&rng](const Sample* begin, const Sample* end) {
+            uint64_t r = static_cast<uint32_t>(rng());
+            return begin[(r * static_cast<uint64_t>(end - begin)) >> 32];
+        };
+
+        std::vector<double> totals(n);
+        std::vector<double> slots(contestSlots);
+        std::vector<uint32_t> order(n);
+
+        for (int it = 0; it < iterations; it++) {
+            for (size_t k = 0; k < n; k++) {
+                const Sample* cBegin = contestSamples.data() + contestSampleOffset[k];
+                const Sample* cEnd = contestSamples.data() + contestSampleOffset[k + 1];
+                const Sample* hBegin = homeworkSamples.data() + homeworkSampleOffset[k];
+                const Sample* hEnd = homeworkSamples.data() + homeworkSampleOffset[k + 1];
+
+                double total = fixedScores[k];
+                std::copy_n(playedSlots.begin() + k * contestSlots, contestSlots,
+                            slots.begin());
+
+                if (cBegin != cEnd) {
+                    for (int j : remainingContests) {
+                        Sample s = draw(cBegin, cEnd);
+                        slots[j] = s.normalizedSolve * contestWeights[j] + s.bonus;
+                        total += s.upsolve;
+                    }
+                    if (simulateFinals) {
+                        Sample s = draw(cBegin, cEnd);
+                        total += s.normalizedSolve * contestWeights[contestSlots] +
+                                 s.bonus + s.upsolve;
+                    }
+                }
+
+                if (hBegin != hEnd) {
+                    for (int j : remainingHomeworks) {
+                        Sample s = draw(hBegin, hEnd);
+                        total += s.normalizedSolve * homeworkWeights[j] + s.bonus +
+                                 s.upsolve;
+                    }
+                }
+
+                std::nth_element(slots.begin(), slots.begin() + dropWorst,
+                                 slots.end());
+                for (int j = dropWorst; j < contestSlots; j++) total += slots[j];
+
+                totals[k] = total;
+                counts.scoreSum[k] += total;
+            }
+
+            std::iota(order.begin(), order.end(), 0);
+            std::sort(order.begin(), order.end(), [&](uint32_t a, uint32_t b) {
+                return totals[a] != totals[b] ? totals[a] > totals[b] : a < b;
+            });
+
+            for (size_t r = 0; r < n; r++) {
+                uint32_t k = order[r];
+                counts.rankSum[k] += r + 1;
+                counts.histogram[k * buckets +
+                                 std::min<size_t>(r, buckets - 1)]++;
+                if (static_cast<int>(r) < options.selectionSize) {
+                    counts.selected[k]++;
+                }
+            }
+        }
+    };
+
+    std::vector<WorkerCounts> counts(threads, WorkerCounts(n, buckets));
+    std::vector<std::thread> pool;
+    for (int t = 0; t < threads; t++) {
+        int share = options.iterations / threads +
+                    (t < options.iterations % threads ? 1 : 0);
+        pool.emplace_back(worker, share, static_cast<uint32_t>(t),
+                          std::ref(counts[t]));
+    }
+    for (auto& thread : pool) thread.join();
+
+    const double runs = options.iterations;
+    std::vector<ContestantProjection> projections(n);
+
+    for (size_t k = 0; k < n; k++) {
+        ContestantProjection& p = projections[k];
+        p.teamID = teamIDs[k];
+        p.currentScore = currentScores[k];
+        p.rankDistribution.assign(buckets, 0.0);
+
+        uint64_t selected = 0, rankSum = 0;
+        double scoreSum = 0.0;
+        for (const WorkerCounts& c : counts) {
+            selected += c.selected[k];
+            rankSum += c.rankSum[k];
+            scoreSum += c.scoreSum[k];
+            for (int b = 0; b < buckets; b++) {
+                p.rankDistribution[b] += c.histogram[k * buckets + b];
+            }
+        }
+
+        p.selectionProbability = selected / runs;
+        p.meanRank = rankSum / runs;
+        p.meanScore = scoreSum / runs;
+        for (double& bucket : p.rankDistribution) bucket /= runs;
+    }
+
+    std::stable_sort(projections.begin(), projections.end(),
+                     [](const auto& a, const auto& b) {
+                         if (a.selectionProbability != b.selectionProbability) {
+                             return a.selectionProbability > b.selectionProbability;
+                         }
+                         return a.meanRank < b.meanRank;
+                     });
+
+    return projections;
+}
+
+void SelectionSimulator::renderCSV(
+    std::ostream& os, const std::vector<ContestantProjection>& projections) {
+    os << "Team ID,Current Score,Mean Score,Selection Probability,Mean Rank";
+    if (!projections.empty()) {
+        const size_t buckets = projections.front().rankDistribution.size();
+        for (size_t b = 0; b < buckets; b++) {
+            os << ",Rank " << (b + 1) << (b + 1 == buckets ? "+" : "");
+        }
+    }
+    os << "\n";
+
+    for (const auto& p : projections) {
+        os << p.teamID << "," << p.currentScore << "," << p.meanScore << ","
+           << p.selectionProbability << "," << p.meanRank;
+        for (double probability : p.rankDistribution) os << "," << probability;
+        os << "\n";
+    }
+}
+
+}  // namespace MaratonaScore
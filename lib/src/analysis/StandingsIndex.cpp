@@ -0,0 +1,207 @@
+//    Copyright 2025 MaratonaCIn
+//
+//    Licensed under the Apache License, Version 2.0 (the "License");
+//    you may not use this file except in compliance with the License.
+//    You may obtain a copy of the License at
+//
+//        http://www.apache.org/licenses/LICENSE-2.0
+//
+//    Unless required by applicable law or agreed to in writing, software
+//    distributed under the License is distributed on an "AS IS" BASIS,
+//    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//    See the License for the specific language governing permissions and
+//    limitations under the License.
+
+
+#include "analysis/StandingsIndex.hpp"
+
+#include <algorithm>
+#include <functional>
+#include <set>
+#include <stdexcept>
+
+#include "score/ScoringPolicy.hpp"
+#include "utils/Settings.hpp"
+#include "utils/StringUtils.hpp"
+
+namespace MaratonaScore {
+
+StandingsIndex::StandingsIndex(const Scoreboard& scoreboard) {
+    const Settings& settings = Settings::getInstance();
+    const int slots = settings.NUMBER_OF_CONTESTS;
+    const int kept =
+        slots - std::clamp(settings.IGNORE_WORST_CONTESTS, 0, slots);
+
+    std::set<int> playedContests;
+    std::set<int> playedHomeworks;
+    bool finalsPlayed = false;
+
+    std::vector<ScoreValue> contestTotals(slots);
+    for (const auto& [teamID, contestant] : scoreboard.getRanking()) {
+        std::fill(contestTotals.begin(), contestTotals.end(), 0);
+
+        for (const auto& [contestId, score] : contestant->getContestScores()) {
+            int slot = contestSlot(contestId, "", slots);
+            if (slot >= 0) {
+                contestTotals[slot] = score.total();
+                playedContests.insert(slot);
+            } else if ((slot = contestSlot(contestId, "H", slots)) >= 0) {
+                playedHomeworks.insert(slot);
+            } else if (contestId == "FINALS") {
+                finalsPlayed = true;
+            }
+        }
+
+        ScoreValue threshold = 0;
+        if (kept > 0) {
+            std::nth_element(contestTotals.begin(),
+                             contestTotals.begin() + (kept - 1),
+                             contestTotals.end(), std::greater<>());
+            threshold = contestTotals[kept - 1];
+        }
+
+        positions[teamID] = static_cast<uint32_t>(teamIDs.size());
+        teamIDs.push_back(teamID);
+        totals.push_back(contestant->getTotalScoreFixed());
+        thresholds.push_back(threshold);
+    }
+
+    withScoringPolicy([&](auto policy) {
+        using Policy = decltype(policy);
+        for (int j = 0; j < slots; j++) {
+            if (!playedContests.count(j)) {
+                remaining.push_back({std::to_string(j + 1), CONTEST,
+                                     Policy::problemValue(CONTEST, j), true});
+            }
+        }
+        for (int j = 0; j < slots; j++) {
+            if (!playedHomeworks.count(j)) {
+                remaining.push_back({"H" + std::to_string(j + 1), HOMEWORK,
+                                     Policy::problemValue(HOMEWORK, j), false});
+            }
+        }
+        if (!finalsPlayed) {
+            remaining.push_back({"FINALS", CONTEST,
+                                 Policy::problemValue(CONTEST, slots), false});
+        }
+    });
+}
+
+size_t StandingsIndex::size() const {
+    return teamIDs.size();
+}
+
+uint32_t StandingsIndex::positionOf(const std::string& teamID) const {
+    auto it = positions.find(teamID);
+    if (it == positions.end()) {
+        throw std::out_of_range("Unknown or blacklisted contestant: " + teamID);
+    }
+    return it->second;
+}
+
+int StandingsIndex::rankOf(const std::string& teamID) const {
+    return static_cast<int>(positionOf(teamID)) + 1;
+}
+
+int StandingsIndex::rankWith(const std::string& teamID,
+                             ScoreValue total) const {
+    const uint32_t self = positionOf(teamID);
+
+    // Contestants ahead: higher total, or same total and smaller team ID
+    // (the ranking's tie order). totals is descending, so a binary search
+    // finds the block of equal totals.
+    auto first = std::lower_bound(totals.begin(), totals.end(), total,
+                                  std::greater<>());
+    auto last = std::upper_bound(first, totals.end(), total, std::greater<>());
+    size_t ahead = first - totals.begin();
+
+    size_t lo = ahead, hi = last - totals.begin();
+    while (lo < hi) {
+        size_t mid = (lo + hi) / 2;
+        if (teamIDs[mid] < teamID) {
+            lo = mid + 1;
+        } else {
+            hi = mid;
+        }
+    }
+    ahead = lo;
+
+    if (self < ahead) ahead--;
+    return static_cast<int>(ahead) + 1;
+}
+
+ScoreValue StandingsIndex::requiredScore(const std::string& teamID,
+                                         int targetRank) const {
+    if (targetRank < 1) {
+        throw std::invalid_argument("Target rank must be at least 1");
+    }
+
+    const uint32_t self = positionOf(teamID);
+    if (self < static_cast<uint32_t>(targetRank)) return 0;
+
+    // Reaching targetRank means overtaking whoever holds it now.
+    const uint32_t rival = targetRank - 1;
+    return totals[rival] - totals[self] +
+           (teamIDs[self] < teamIDs[rival] ? 0 : 1);
+}
+
+Requirement StandingsIndex::query(const std::string& teamID,
+                                  int targetRank) const {
+    const uint32_t self = positionOf(teamID);
+
+    Requirement requirement{teamID, static_cast<int>(self) + 1, targetRank,
+                            totals[self], requiredScore(teamID, targetRank),
+                            {}};
+
+    for (const Round& round : remaining) {
+        ScoreValue needed = requirement.additionalScore;
+        if (needed > 0 && round.dropped) needed += thresholds[self];
+
+        int problems = -1;
+        if (needed == 0) {
+            problems = 0;
+        } else if (round.problemValue > 0) {
+            problems = static_cast<int>((needed + round.problemValue - 1) /
+                                        round.problemValue);
+        }
+
+        requirement.rounds.push_back(
+            {round.id, round.type, round.problemValue, needed, problems});
+    }
+
+    return requirement;
+}
+
+std::vector<Requirement> StandingsIndex::queryAll(int targetRank) const {
+    std::vector<Requirement> requirements;
+    requirements.reserve(teamIDs.size());
+    for (const std::string& teamID : teamIDs) {
+        requirements.push_back(query(teamID, targetRank));
+    }
+    return requirements;
+}
+
+void StandingsIndex::renderCSV(std::ostream& os,
+                               const std::vector<Requirement>& requirements) {
+    os << "Team ID,Current Rank,Target Rank,Current Score,Additional Score";
+    if (!requirements.empty()) {
+        for (const RoundRequirement& round : requirements.front().rounds) {
+            os << ",Problems in " << round.round;
+        }
+    }
+    os << "\n";
+
+    for (const Requirement& requirement : requirements) {
+        os << requirement.teamID << "," << requirement.currentRank << ","
+           << requirement.targetRank << ","
+           << toDouble(requirement.currentScore) << ","
+           << toDouble(requirement.additionalScore);
+        for (const RoundRequirement& round : requirement.rounds) {
+            os << ",";
+            if (round.problems >= 0) os << round.problems;
+        }
+        os << "\n";
+    }
+}
+
+}  // namespace MaratonaScore
@@ -14,7 +14,12 @@
 
 #include "models/Contest.hpp"
 
+#include <algorithm>
+
 #include "parser/ScoreboardParser.hpp"
+#include "score/getScore.hpp"
+#include "utils/Blacklist.hpp"
+#include "utils/Settings.hpp"
 
 namespace MaratonaScore {
 
@@ -41,6 +46,86 @@ void Contest::setType(CONTEST_TYPE contestType) { type = contestType; }
 void Contest::addPerformance(const std::string& teamID,
                              const Performance& perf) {
     performances[teamID] = perf;
+    standings.clear();
+}
+
+bool Contest::ranksBefore(const std::string& a, const std::string& b) const {
+    const Performance& pa = performances.at(a);
+    const Performance& pb = performances.at(b);
+    if (pa < pb) return true;
+    if (pb < pa) return false;
+    return a < b;
+}
+
+std::vector<std::string> Contest::applyPatch(const RejudgePatch& patch) {
+    // Blacklisted teams were never ranked; a patch must not rank them.
+    if (Blacklist::isBlacklisted(patch.teamID)) return {};
+
+    if (standings.size() != performances.size()) {
+        standings.clear();
+        for (const auto& [teamID, performance] : performances) {
+            standings.push_back(teamID);
+        }
+        std::stable_sort(standings.begin(), standings.end(),
+                         [&](const std::string& a, const std::string& b) {
+                             return performances.at(a).getRank() <
+                                    performances.at(b).getRank();
+                         });
+    }
+
+    auto [it, inserted] = performances.try_emplace(patch.teamID);
+    size_t from;
+    if (inserted) {
+        from = standings.size();
+        standings.push_back(patch.teamID);
+    } else {
+        from = it->second.getRank() - 1;
+        if (from >= standings.size() || standings[from] != patch.teamID) {
+            from = std::find(standings.begin(), standings.end(),
+                             patch.teamID) -
+                   standings.begin();
+        }
+    }
+
+    ProblemStatus status;
+    if (patch.verdict == REJUDGE_ACCEPTED) {
+        const Settings& settings = Settings::getInstance();
+        int limit = type == HOMEWORK ? settings.HOMEWORK_TIME_LIMIT
+                                     : settings.CONTEST_TIME_LIMIT;
+        status = ProblemStatus(patch.time <= limit ? SOLVED : UPSOLVED,
+                               patch.time, patch.tries);
+    } else if (patch.verdict == REJUDGE_REJECTED) {
+        status = ProblemStatus(ATTEMPTED, 0, patch.tries);
+    }
+    it->second.updateProblem(patch.problemId, status);
+
+    // Slide the team up or down to its new position
+    auto begin = standings.begin();
+    auto before = [&](const std::string& a, const std::string& b) {
+        return ranksBefore(a, b);
+    };
+    size_t to = from;
+    if (from > 0 && ranksBefore(patch.teamID, standings[from - 1])) {
+        to = std::lower_bound(begin, begin + from, patch.teamID, before) - begin;
+        std::rotate(begin + to, begin + from, begin + from + 1);
+    } else if (from + 1 < standings.size() &&
+               ranksBefore(standings[from + 1], patch.teamID)) {
+        to = std::lower_bound(begin + from + 1, standings.end(), patch.teamID,
+                              before) -
+             begin - 1;
+        std::rotate(begin + from, begin + from + 1, begin + to + 1);
+    }
+
+    std::vector<std::string> affected;
+    for (size_t i = std::min(from, to); i <= std::max(from, to); i++) {
+        Performance& performance = performances.at(standings[i]);
+        int rank = static_cast<int>(i) + 1;
+        performance.setRank(rank);
+        performance.setBonusScore(getRankBonus(type, rank));
+        affected.push_back(standings[i]);
+    }
+
+    return affected;
 }
 
 }  // namespace MaratonaScore
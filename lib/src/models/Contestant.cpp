@@ -16,51 +16,60 @@
 
 namespace MaratonaScore {
 
-void Contestant::addScoreContest(double s) {
+void Contestant::addScoreContest(ScoreValue s) {
     scoreContest += s;
     fixScore();
 }
 
-void Contestant::addScoreHomework(double s) {
+void Contestant::addScoreHomework(ScoreValue s) {
     scoreHomework += s;
     fixScore();
 }
 
-void Contestant::addScoreUpsolved(double s) {
+void Contestant::addScoreUpsolved(ScoreValue s) {
     scoreUpsolved += s;
     fixScore();
 }
 
-void Contestant::addScoreBonus(double s) {
+void Contestant::addScoreBonus(ScoreValue s) {
     scoreBonus += s;
     fixScore();
 }
 
 double Contestant::getScoreContest() const {
-    return scoreContest;
+    return toDouble(scoreContest);
 }
 
 double Contestant::getScoreHomework() const {
-    return scoreHomework;
+    return toDouble(scoreHomework);
 }
 
 double Contestant::getScoreUpsolved() const {
-    return scoreUpsolved;
+    return toDouble(scoreUpsolved);
 }
 
 double Contestant::getScoreBonus() const {
-    return scoreBonus;
+    return toDouble(scoreBonus);
 }
 
 double Contestant::getTotalScore() const {
+    return toDouble(score);
+}
+
+ScoreValue Contestant::getTotalScoreFixed() const {
     return score;
 }
 
+const std::map<std::string, Contestant::ContestScore>&
+Contestant::getContestScores() const {
+    return contestScores;
+}
+
 void Contestant::fixScore() {
     score = scoreContest + scoreHomework + scoreUpsolved + scoreBonus;
 }
 
-double Contestant::ContestScore::total() const {
+ScoreValue Contestant::ContestScore::total() const {
     return solve + bonus;
 }
 
@@ -48,10 +48,10 @@ void ProblemStatus::setAttempts(int att) {
 
 // Performance implementations
 Performance::Performance()
-    : rank(0), penalty(0), problems_solved(0), problems_attempted(0), problems_upsolved(0), bonus_score(0.0) {}
+    : rank(0), penalty(0), problems_solved(0), problems_attempted(0), problems_upsolved(0), bonus_score(0) {}
 
 Performance::Performance(int r, int p)
-    : rank(r), penalty(p), problems_solved(0), problems_attempted(0), problems_upsolved(0), bonus_score(0.0) {}
+    : rank(r), penalty(p), problems_solved(0), problems_attempted(0), problems_upsolved(0), bonus_score(0) {}
 
 int Performance::getRank() const {
     return rank;
@@ -73,7 +73,7 @@ int Performance::getProblemsUpsolved() const {
     return problems_upsolved;
 }
 
-double Performance::getBonusScore() const {
+ScoreValue Performance::getBonusScore() const {
     return bonus_score;
 }
 
@@ -89,7 +89,7 @@ void Performance::setPenalty(int p) {
     penalty = p;
 }
 
-void Performance::setBonusScore(double bonus) {
+void Performance::setBonusScore(ScoreValue bonus) {
     bonus_score = bonus;
 }
 
@@ -111,6 +111,30 @@ void Performance::addProblem(const std::string& problemId, const ProblemStatus&
     }
 }
 
+void Performance::updateProblem(const std::string& problemId,
+                                const ProblemStatus& status) {
+    auto it = problems.find(problemId);
+    if (it != problems.end()) {
+        const ProblemStatus& old = it->second;
+        if (old.getStatus() == SOLVED) {
+            problems_solved--;
+            penalty -= old.getTimeTaken() + old.getAttempts() * 20;
+        } else if (old.getStatus() == UPSOLVED) {
+            problems_upsolved--;
+        } else if (old.getStatus() == ATTEMPTED) {
+            problems_attempted--;
+        }
+        problems.erase(it);
+    }
+
+    if (status.getStatus() == NOT_ATTEMPTED) return;
+
+    addProblem(problemId, status);
+    if (status.getStatus() == SOLVED) {
+        penalty += status.getTimeTaken() + status.getAttempts() * 20;
+    }
+}
+
 bool Performance::operator<(const Performance& other) const {
     if (problems_solved != other.problems_solved) {
         return problems_solved > other.problems_solved;
@@ -16,46 +16,120 @@
 
 #include <algorithm>
 #include <iostream>
+#include <stdexcept>
+#include <tuple>
 #include <vector>
 
+#include "score/ScoringPolicy.hpp"
 #include "score/getScore.hpp"
 #include "utils/Blacklist.hpp"
+#include "utils/RadixSort.hpp"
 #include "utils/Settings.hpp"
 
 namespace MaratonaScore {
 
-void Scoreboard::addContest(const Contest& contest, int index) {
-    for (auto [teamID, performance] : contest.getPerformances()) {
-        contestants[teamID].ContestsPerformance[contest.getId()] = &performance;
+namespace {
 
-        if (contest.getType() == CONTEST) {
-            double solve = getSolveScore(contest.getType(), performance, index);
-            double upsolve = getUpsolveScore(performance);
-            double bonus = performance.getBonusScore();
+template <typename Scorer>
+Contestant::ContestScore scoreOf(const Scorer& solveScorer,
+                                 const Performance& performance,
+                                 const Contest& contest, int index) {
+    Contestant::ContestScore score{solveScorer(performance),
+                                   performance.getBonusScore(),
+                                   getUpsolveScore(performance)};
+    score.index = index;
+    score.type = contest.getType();
+    score.solved = performance.getProblemsSolved();
+    score.upsolved = performance.getProblemsUpsolved();
+    return score;
+}
 
-            contestants[teamID].addScoreContest(solve);
-            contestants[teamID].addScoreUpsolved(upsolve);
-            contestants[teamID].addScoreBonus(bonus);
+void renderRow(std::ostream& os, const std::string& teamID,
+               const Contestant& contestant) {
+    os << teamID << "," << contestant.getScoreContest() << ","
+       << contestant.getScoreHomework() << "," << contestant.getScoreUpsolved()
+       << "," << contestant.getScoreBonus() << "," << contestant.getTotalScore();
+}
 
-            contestants[teamID].contestScores[contest.getId()] = {solve, bonus};
-        }
+}  // namespace
 
-        if (contest.getType() == HOMEWORK) {
-            double solve = getSolveScore(contest.getType(), performance, index);
-            double upsolve = getUpsolveScore(performance);
-            double bonus = performance.getBonusScore();
+template <typename Scorer>
+void Scoreboard::foldContest(const Contest& contest, int index,
+                             const Scorer& solveScorer) {
+    for (const auto& [teamID, performance] : contest.getPerformances()) {
+        Contestant::ContestScore score =
+            scoreOf(solveScorer, performance, contest, index);
 
-            contestants[teamID].addScoreHomework(solve);
-            contestants[teamID].addScoreUpsolved(upsolve);
-            contestants[teamID].addScoreBonus(bonus);
+        if (contest.getType() == CONTEST) {
+            contestants[teamID].addScoreContest(score.solve);
+        } else if (contest.getType() == HOMEWORK) {
+            contestants[teamID].addScoreHomework(score.solve);
         }
+        contestants[teamID].addScoreUpsolved(score.upsolve);
+        contestants[teamID].addScoreBonus(score.bonus);
+
+        contestants[teamID].contestScores[contest.getId()] = score;
     }
 }
 
-void Scoreboard::renderCSV(std::ostream& os) const {
+void Scoreboard::addContest(const Contest& contest, int index) {
+    if (Settings::getInstance().RATING_ENABLED) ratings.update(contest);
+
+    withScoringPolicy([&](auto policy) {
+        foldContest(contest, index,
+                    decltype(policy)::solveScorer(contest, index));
+    });
+}
+
+void Scoreboard::addContest(const Contest& contest, int index,
+                            const ContestTally& tally) {
+    withScoringPolicy([&](auto policy) {
+        foldContest(contest, index,
+                    decltype(policy)::solveScorer(tally, contest.getType(),
+                                                  index));
+    });
+}
+
+void Scoreboard::renderCSVHeader(std::ostream& os, bool rated) {
     os << "Team ID,Total Contest Score,Total Homework Score,Total Upsolved "
-          "Score,Bonus Score,Overall Score\n";
+          "Score,Bonus Score,Overall Score"
+       << (rated ? ",Rating\n" : "\n");
+}
 
+void Scoreboard::renderCSV(std::ostream& os) const {
+    const bool rated = Settings::getInstance().RATING_ENABLED;
+
+    renderCSVHeader(os, rated);
+
+    for (const auto& [teamID, contestant] : getRanking()) {
+        renderRow(os, teamID, *contestant);
+        if (rated) os << "," << ratings.getRating(teamID);
+        os << "\n";
+    }
+}
+
+void Scoreboard::renderRun(std::ostream& os) const {
+    for (const auto& [teamID, contestant] : getRanking()) {
+        os << contestant->getTotalScoreFixed() << '\t' << teamID << '\t';
+        renderRow(os, teamID, *contestant);
+        os << "\n";
+    }
+}
+
+RatingEngine& Scoreboard::getRatings() {
+    return ratings;
+}
+
+const RatingEngine& Scoreboard::getRatings() const {
+    return ratings;
+}
+
+const std::map<std::string, Contestant>& Scoreboard::getContestants() const {
+    return contestants;
+}
+
+std::vector<std::pair<std::string, const Contestant*>> Scoreboard::getRanking()
+    const {
     // Create sorted list of contestants by total score (descending)
     std::vector<std::pair<std::string, const Contestant*>> sortedContestants;
 
@@ -65,18 +139,51 @@ void Scoreboard::renderCSV(std::ostream& os) const {
         }
     }
 
-    std::sort(sortedContestants.begin(), sortedContestants.end(),
-              [](const auto& a, const auto& b) {
-                  return a.second->getTotalScore() > b.second->getTotalScore();
-              });
+    // Stable, so equal totals keep team ID order from the map
+    radixSort(sortedContestants, [](const auto& entry) {
+        return descendingKey(entry.second->getTotalScoreFixed());
+    });
 
-    for (const auto& [teamID, contestant] : sortedContestants) {
-        os << teamID << "," << contestant->getScoreContest() << ","
-           << contestant->getScoreHomework() << ","
-           << contestant->getScoreUpsolved() << ","
-           << contestant->getScoreBonus() << "," << contestant->getTotalScore()
-           << "\n";
+    return sortedContestants;
+}
+
+Explanation Scoreboard::explain(const std::string& teamID) const {
+    auto found = contestants.find(teamID);
+    if (found == contestants.end()) {
+        throw std::out_of_range("Unknown contestant: " + teamID);
     }
+    const Contestant& contestant = found->second;
+
+    Explanation explanation{teamID,
+                            {},
+                            contestant.scoreContest,
+                            contestant.scoreHomework,
+                            contestant.scoreUpsolved,
+                            contestant.scoreBonus,
+                            contestant.score};
+
+    withScoringPolicy([&](auto policy) {
+        for (const auto& [contestId, score] : contestant.contestScores) {
+            bool dropped =
+                std::find(contestant.droppedContests.begin(),
+                          contestant.droppedContests.end(),
+                          contestId) != contestant.droppedContests.end();
+
+            explanation.contests.push_back(
+                {contestId, score.type, score.index,
+                 decltype(policy)::problemValue(score.type, score.index),
+                 score.solved, score.upsolved, score.solve, score.upsolve,
+                 score.bonus, dropped});
+        }
+    });
+
+    std::stable_sort(explanation.contests.begin(), explanation.contests.end(),
+                     [](const ContestBreakdown& a, const ContestBreakdown& b) {
+                         return std::tie(a.index, a.type) <
+                                std::tie(b.index, b.type);
+                     });
+
+    return explanation;
 }
 
 std::ostream& operator<<(std::ostream& os, const Scoreboard& sb) {
@@ -101,42 +208,104 @@ std::ostream& operator<<(std::ostream& os, const Scoreboard& sb) {
 void Scoreboard::applyContestFiltering() {
     if (Settings::getInstance().IGNORE_WORST_CONTESTS == 0) return;
 
+    filtered = true;
     for (auto& [teamID, contestant] : contestants) {
-        std::vector<std::pair<std::string, double>> allContestScores;
+        dropWorstContests(contestant);
+    }
+}
 
-        for (int i = 1; i <= Settings::getInstance().NUMBER_OF_CONTESTS; i++) {
-            std::string contestId = std::to_string(i);
+void Scoreboard::dropWorstContests(Contestant& contestant) {
+    std::vector<std::pair<std::string, ScoreValue>> allContestScores;
 
-            auto it = contestant.contestScores.find(contestId);
-            if (it != contestant.contestScores.end()) {
-                allContestScores.push_back({contestId, it->second.total()});
-            } else {
-                allContestScores.push_back({contestId, 0.0});
-            }
+    for (int i = 1; i <= Settings::getInstance().NUMBER_OF_CONTESTS; i++) {
+        std::string contestId = std::to_string(i);
+
+        auto it = contestant.contestScores.find(contestId);
+        if (it != contestant.contestScores.end()) {
+            allContestScores.push_back({contestId, it->second.total()});
+        } else {
+            allContestScores.push_back({contestId, 0});
         }
+    }
 
-        std::sort(
-            allContestScores.begin(), allContestScores.end(),
-            [](const auto& a, const auto& b) { return a.second < b.second; });
+    std::stable_sort(
+        allContestScores.begin(), allContestScores.end(),
+        [](const auto& a, const auto& b) { return a.second < b.second; });
 
-        double solveToSubtract = 0.0;
-        double bonusToSubtract = 0.0;
+    ScoreValue solveToSubtract = 0;
+    ScoreValue bonusToSubtract = 0;
 
-        for (int i = 0; i < Settings::getInstance().IGNORE_WORST_CONTESTS;
-             i++) {
-            const std::string& contestId = allContestScores[i].first;
+    for (int i = 0; i < Settings::getInstance().IGNORE_WORST_CONTESTS; i++) {
+        const std::string& contestId = allContestScores[i].first;
+        contestant.droppedContests.push_back(contestId);
 
-            auto it = contestant.contestScores.find(contestId);
-            if (it != contestant.contestScores.end()) {
-                solveToSubtract += it->second.solve;
-                bonusToSubtract += it->second.bonus;
-            }
+        auto it = contestant.contestScores.find(contestId);
+        if (it != contestant.contestScores.end()) {
+            solveToSubtract += it->second.solve;
+            bonusToSubtract += it->second.bonus;
         }
+    }
 
-        contestant.scoreContest -= solveToSubtract;
-        contestant.scoreBonus -= bonusToSubtract;
-        contestant.fixScore();
+    contestant.scoreContest -= solveToSubtract;
+    contestant.scoreBonus -= bonusToSubtract;
+    contestant.fixScore();
+}
+
+void Scoreboard::restoreDroppedContests(Contestant& contestant) {
+    for (const std::string& contestId : contestant.droppedContests) {
+        auto it = contestant.contestScores.find(contestId);
+        if (it != contestant.contestScores.end()) {
+            contestant.scoreContest += it->second.solve;
+            contestant.scoreBonus += it->second.bonus;
+        }
+    }
+    contestant.droppedContests.clear();
+    contestant.fixScore();
+}
+
+void Scoreboard::applyRejudge(Contest& contest, int index,
+                              const RejudgePatch& patch) {
+    std::vector<std::string> affected = contest.applyPatch(patch);
+    if (affected.empty()) return;
+
+    // Difficulty-weighted values depend on every solver of the problem
+    if (Settings::getInstance().SCORE_PROBLEM_VALUE == DIFFICULTY_VALUE) {
+        affected.clear();
+        for (const auto& [teamID, performance] : contest.getPerformances()) {
+            affected.push_back(teamID);
+        }
     }
+
+    withScoringPolicy([&](auto policy) {
+        const auto solveScorer =
+            decltype(policy)::solveScorer(contest, index);
+
+        for (const std::string& teamID : affected) {
+            const Performance& performance =
+                contest.getPerformances().at(teamID);
+            Contestant& contestant = contestants[teamID];
+
+            Contestant::ContestScore updated =
+                scoreOf(solveScorer, performance, contest, index);
+            Contestant::ContestScore previous{0, 0, 0};
+            auto it = contestant.contestScores.find(contest.getId());
+            if (it != contestant.contestScores.end()) previous = it->second;
+
+            if (filtered) restoreDroppedContests(contestant);
+
+            if (contest.getType() == CONTEST) {
+                contestant.scoreContest += updated.solve - previous.solve;
+            } else if (contest.getType() == HOMEWORK) {
+                contestant.scoreHomework += updated.solve - previous.solve;
+            }
+            contestant.scoreUpsolved += updated.upsolve - previous.upsolve;
+            contestant.scoreBonus += updated.bonus - previous.bonus;
+            contestant.contestScores[contest.getId()] = updated;
+            contestant.fixScore();
+
+            if (filtered) dropWorstContests(contestant);
+        }
+    });
 }
 
 }  // namespace MaratonaScore
\ No newline at end of file
@@ -0,0 +1,193 @@
+//    Copyright 2025 MaratonaCIn
+//
+//    Licensed under the Apache License, Version 2.0 (the "License");
+//    you may not use this file except in compliance with the License.
+//    You may obtain a copy of the License at
+//
+//        http://www.apache.org/licenses/LICENSE-2.0
+//
+//    Unless required by applicable law or agreed to in writing, software
+//    distributed under the License is distributed on an "AS IS" BASIS,
+//    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//    See the License for the specific language governing permissions and
+//    limitations under the License.
+
+
+#include "models/StreamingScoreboard.hpp"
+
+#include <algorithm>
+#include <stdexcept>
+
+#include "models/Scoreboard.hpp"
+#include "score/ScoringPolicy.hpp"
+#include "score/getScore.hpp"
+#include "utils/Blacklist.hpp"
+#include "utils/RadixSort.hpp"
+#include "utils/Settings.hpp"
+
+namespace MaratonaScore {
+
+ScoreValue StreamingScoreboard::Totals::total() const {
+    return contest + homework + upsolved + bonus;
+}
+
+StreamingScoreboard::StreamingScoreboard()
+    : contests(Settings::getInstance().NUMBER_OF_CONTESTS),
+      width(2 * static_cast<size_t>(contests) + 1) {}
+
+uint32_t StreamingScoreboard::intern(const std::string& teamID) {
+    auto [it, inserted] =
+        rows.emplace(teamID, static_cast<uint32_t>(teamIDs.size()));
+    if (inserted) {
+        teamIDs.push_back(teamID);
+        cells.resize(cells.size() + width, Cell{0, 0, 0});
+    }
+    return it->second;
+}
+
+size_t StreamingScoreboard::slotOf(CONTEST_TYPE type, int index) const {
+    const int last = type == HOMEWORK ? contests - 1 : contests;
+    if (index < 0 || index > last) {
+        throw std::out_of_range("Contest index " + std::to_string(index) +
+                                " is outside the season");
+    }
+    return type == HOMEWORK ? contests + 1 + index : index;
+}
+
+void StreamingScoreboard::addContest(const Contest& contest, int index) {
+    const size_t slot = slotOf(contest.getType(), index);
+
+    if (Settings::getInstance().RATING_ENABLED) ratings.update(contest);
+
+    withScoringPolicy([&](auto policy) {
+        const auto solveScorer =
+            decltype(policy)::solveScorer(contest, index);
+
+        for (const auto& [teamID, performance] : contest.getPerformances()) {
+            Cell& cell = cells[intern(teamID) * width + slot];
+            cell.solve += solveScorer(performance);
+            cell.bonus += performance.getBonusScore();
+            cell.upsolve += getUpsolveScore(performance);
+        }
+    });
+}
+
+int StreamingScoreboard::worstContests(
+    uint32_t row, std::vector<std::pair<ScoreValue, int>>& totals) const {
+    const int ignore =
+        std::min(Settings::getInstance().IGNORE_WORST_CONTESTS, contests);
+    if (ignore <= 0) return 0;
+
+    const Cell* base = &cells[row * width];
+    totals.resize(contests);
+    for (int i = 0; i < contests; i++) {
+        totals[i] = {base[i].solve + base[i].bonus, i};
+    }
+
+    // Same tie order as Scoreboard: the earlier round is dropped first
+    std::stable_sort(
+        totals.begin(), totals.end(),
+        [](const auto& a, const auto& b) { return a.first < b.first; });
+
+    return ignore;
+}
+
+void StreamingScoreboard::applyContestFiltering() {
+    std::vector<std::pair<ScoreValue, int>> totals;
+    for (uint32_t row = 0; row < teamIDs.size(); row++) {
+        const int ignore = worstContests(row, totals);
+        Cell* base = &cells[row * width];
+
+        for (int i = 0; i < ignore; i++) {
+            base[totals[i].second].solve = 0;
+            base[totals[i].second].bonus = 0;
+        }
+    }
+}
+
+ScoreValue StreamingScoreboard::getDroppedScore(uint32_t row) const {
+    std::vector<std::pair<ScoreValue, int>> totals;
+    const int ignore = worstContests(row, totals);
+
+    ScoreValue dropped = 0;
+    for (int i = 0; i < ignore; i++) dropped += totals[i].first;
+    return dropped;
+}
+
+RatingEngine& StreamingScoreboard::getRatings() {
+    return ratings;
+}
+
+const RatingEngine& StreamingScoreboard::getRatings() const {
+    return ratings;
+}
+
+size_t StreamingScoreboard::size() const {
+    return teamIDs.size();
+}
+
+const std::string& StreamingScoreboard::getTeamID(uint32_t row) const {
+    return teamIDs.at(row);
+}
+
+uint32_t StreamingScoreboard::getRow(const std::string& teamID) const {
+    return rows.at(teamID);
+}
+
+StreamingScoreboard::Totals StreamingScoreboard::getTotals(uint32_t row) const {
+    Totals totals;
+    const Cell* base = &cells.at(row * width);
+
+    for (size_t slot = 0; slot < width; slot++) {
+        if (slot <= static_cast<size_t>(contests)) {
+            totals.contest += base[slot].solve;
+        } else {
+            totals.homework += base[slot].solve;
+        }
+        totals.bonus += base[slot].bonus;
+        totals.upsolved += base[slot].upsolve;
+    }
+
+    return totals;
+}
+
+std::vector<uint32_t> StreamingScoreboard::getRanking() const {
+    std::vector<std::pair<uint32_t, ScoreValue>> ranking;
+    ranking.reserve(teamIDs.size());
+
+    for (uint32_t row = 0; row < teamIDs.size(); row++) {
+        if (!Blacklist::isBlacklisted(teamIDs[row])) {
+            ranking.push_back({row, getTotals(row).total()});
+        }
+    }
+
+    // Rows are in first-seen order; put them in team ID order so ties break
+    // exactly like the map-backed Scoreboard.
+    std::sort(ranking.begin(), ranking.end(), [&](const auto& a, const auto& b) {
+        return teamIDs[a.first] < teamIDs[b.first];
+    });
+    radixSort(ranking,
+              [](const auto& entry) { return descendingKey(entry.second); });
+
+    std::vector<uint32_t> order;
+    order.reserve(ranking.size());
+    for (const auto& [row, total] : ranking) order.push_back(row);
+    return order;
+}
+
+void StreamingScoreboard::renderCSV(std::ostream& os) const {
+    const bool rated = Settings::getInstance().RATING_ENABLED;
+
+    Scoreboard::renderCSVHeader(os, rated);
+
+    for (uint32_t row : getRanking()) {
+        Totals totals = getTotals(row);
+        os << teamIDs[row] << "," << toDouble(totals.contest) << ","
+           << toDouble(totals.homework) << "," << toDouble(totals.upsolved)
+           << "," << toDouble(totals.bonus) << "," << toDouble(totals.total());
+        if (rated) os << "," << ratings.getRating(teamIDs[row]);
+        os << "\n";
+    }
+}
+
+}  // namespace MaratonaScore
@@ -0,0 +1,324 @@
+//    Copyright 2025 MaratonaCIn
+//
+//    Licensed under the Apache License, Version 2.0 (the "License");
+//    you may not use this file except in compliance with the License.
+//    You may obtain a copy of the License at
+//
+//        http://www.apache.org/licenses/LICENSE-2.0
+//
+//    Unless required by applicable law or agreed to in writing, software
+//    distributed under the License is distributed on an "AS IS" BASIS,
+//    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//    See the License for the specific language governing permissions and
+//    limitations under the License.
+
+#include "output/ArrowExport.hpp"
+
+#include <algorithm>
+#include <cctype>
+#include <memory>
+#include <set>
+#include <string>
+#include <tuple>
+#include <vector>
+
+#include "utils/Settings.hpp"
+#include "utils/StringUtils.hpp"
+
+namespace MaratonaScore {
+
+namespace {
+
+// One exported column. It becomes the private_data of its ArrowArray, so
+// the vectors below are the buffers handed out to the consumer.
+struct Column {
+    std::string name;
+    std::string format;
+    bool nullable = false;
+
+    std::vector<uint8_t> validity;
+    std::vector<int32_t> ints;
+    std::vector<double> doubles;
+    std::vector<int32_t> offsets{0};
+    std::vector<char> chars;
+
+    int64_t length = 0;
+    int64_t nullCount = 0;
+    std::vector<const void*> buffers;
+
+    void setValid(bool valid) {
+        if (nullable) {
+            if (validity.size() * 8 <= static_cast<size_t>(length)) {
+                validity.push_back(0);
+            }
+            if (valid) validity[length / 8] |= uint8_t(1u << (length % 8));
+        }
+        if (!valid) nullCount++;
+    }
+
+    void appendInt(int32_t value) {
+        setValid(true);
+        ints.push_back(value);
+        length++;
+    }
+
+    void appendDouble(double value) {
+        setValid(true);
+        doubles.push_back(value);
+        length++;
+    }
+
+    void appendNull() {
+        setValid(false);
+        doubles.push_back(0.0);
+        length++;
+    }
+
+    void appendString(const std::string& value) {
+        setValid(true);
+        chars.insert(chars.end(), value.begin(), value.end());
+        offsets.push_back(static_cast<int32_t>(chars.size()));
+        length++;
+    }
+};
+
+Column makeColumn(const std::string& name, const std::string& format,
+                  bool nullable = false) {
+    Column column;
+    column.name = name;
+    column.format = format;
+    column.nullable = nullable;
+    return column;
+}
+
+struct SchemaPrivate {
+    std::string format;
+    std::string name;
+    std::vector<ArrowSchema*> children;
+};
+
+struct StructPrivate {
+    std::vector<ArrowArray*> children;
+    std::vector<const void*> buffers{nullptr};
+};
+
+void releaseSchema(ArrowSchema* schema) {
+    auto* priv = static_cast<SchemaPrivate*>(schema->private_data);
+    for (ArrowSchema* child : priv->children) {
+        if (child->release) child->release(child);
+        delete child;
+    }
+    delete priv;
+    schema->release = nullptr;
+}
+
+void releaseColumn(ArrowArray* array) {
+    delete static_cast<Column*>(array->private_data);
+    array->release = nullptr;
+}
+
+void releaseStruct(ArrowArray* array) {
+    auto* priv = static_cast<StructPrivate*>(array->private_data);
+    for (ArrowArray* child : priv->children) {
+        if (child->release) child->release(child);
+        delete child;
+    }
+    delete priv;
+    array->release = nullptr;
+}
+
+// Own a child until its parent's private data takes it over, so a failed
+// allocation halfway through an export releases what was already built.
+struct SchemaDeleter {
+    void operator()(ArrowSchema* schema) const {
+        if (schema->release) schema->release(schema);
+        delete schema;
+    }
+};
+
+struct ArrayDeleter {
+    void operator()(ArrowArray* array) const {
+        if (array->release) array->release(array);
+        delete array;
+    }
+};
+
+void fillSchema(ArrowSchema* schema, SchemaPrivate* priv, int64_t flags) {
+    schema->format = priv->format.c_str();
+    schema->name = priv->name.c_str();
+    schema->metadata = nullptr;
+    schema->flags = flags;
+    schema->n_children = static_cast<int64_t>(priv->children.size());
+    schema->children = priv->children.empty() ? nullptr : priv->children.data();
+    schema->dictionary = nullptr;
+    schema->release = releaseSchema;
+    schema->private_data = priv;
+}
+
+void exportColumns(std::vector<Column>&& columns, int64_t rows,
+                   ArrowSchema* schema, ArrowArray* array) {
+    auto schemaPriv = std::make_unique<SchemaPrivate>();
+    schemaPriv->format = "+s";
+
+    auto arrayPriv = std::make_unique<StructPrivate>();
+
+    std::vector<std::unique_ptr<ArrowSchema, SchemaDeleter>> childSchemas;
+    std::vector<std::unique_ptr<ArrowArray, ArrayDeleter>> childArrays;
+    childSchemas.reserve(columns.size());
+    childArrays.reserve(columns.size());
+
+    for (Column& source : columns) {
+        auto childSchemaPriv = std::make_unique<SchemaPrivate>(
+            SchemaPrivate{source.format, source.name, {}});
+        childSchemas.emplace_back(new ArrowSchema());
+        fillSchema(childSchemas.back().get(), childSchemaPriv.release(),
+                   source.nullable ? ARROW_FLAG_NULLABLE : 0);
+
+        auto column = std::make_unique<Column>(std::move(source));
+        column->buffers.push_back(column->nullCount ? column->validity.data()
+                                                    : nullptr);
+        if (column->format == "u") {
+            column->buffers.push_back(column->offsets.data());
+            column->buffers.push_back(column->chars.data());
+        } else if (column->format == "i") {
+            column->buffers.push_back(column->ints.data());
+        } else {
+            column->buffers.push_back(column->doubles.data());
+        }
+
+        childArrays.emplace_back(new ArrowArray());
+        ArrowArray* child = childArrays.back().get();
+        child->length = column->length;
+        child->null_count = column->nullCount;
+        child->offset = 0;
+        child->n_buffers = static_cast<int64_t>(column->buffers.size());
+        child->n_children = 0;
+        child->buffers = column->buffers.data();
+        child->children = nullptr;
+        child->dictionary = nullptr;
+        child->release = releaseColumn;
+        child->private_data = column.release();
+    }
+
+    // Nothing below throws once the parents have room for every child.
+    schemaPriv->children.reserve(childSchemas.size());
+    arrayPriv->children.reserve(childArrays.size());
+    for (auto& child : childSchemas) {
+        schemaPriv->children.push_back(child.release());
+    }
+    for (auto& child : childArrays) {
+        arrayPriv->children.push_back(child.release());
+    }
+
+    fillSchema(schema, schemaPriv.release(), 0);
+
+    array->length = rows;
+    array->null_count = 0;
+    array->offset = 0;
+    array->n_buffers = 1;
+    array->n_children = static_cast<int64_t>(arrayPriv->children.size());
+    array->buffers = arrayPriv->buffers.data();
+    array->children =
+        arrayPriv->children.empty() ? nullptr : arrayPriv->children.data();
+    array->dictionary = nullptr;
+    array->release = releaseStruct;
+    array->private_data = arrayPriv.release();
+}
+
+}  // namespace
+
+void exportScoreboard(const Scoreboard& scoreboard, ArrowSchema* schema,
+                      ArrowArray* array) {
+    auto ranking = scoreboard.getRanking();
+
+    std::set<std::string, decltype(&contestIdLess)> contestIds(contestIdLess);
+    for (const auto& [teamID, contestant] : ranking) {
+        for (const auto& [contestId, score] : contestant->getContestScores()) {
+            contestIds.insert(contestId);
+        }
+    }
+
+    const bool rated = Settings::getInstance().RATING_ENABLED;
+
+    std::vector<Column> columns;
+    columns.push_back(makeColumn("rank", "i"));
+    columns.push_back(makeColumn("team_id", "u"));
+    for (const char* name : {"contest_score", "homework_score", "upsolved_score",
+                             "bonus_score", "total_score"}) {
+        columns.push_back(makeColumn(name, "g"));
+    }
+    if (rated) columns.push_back(makeColumn("rating", "g"));
+    for (const auto& contestId : contestIds) {
+        for (const char* part : {".solve", ".bonus", ".upsolve"}) {
+            columns.push_back(makeColumn(contestId + part, "g", true));
+        }
+    }
+
+    int32_t rank = 1;
+    for (const auto& [teamID, contestant] : ranking) {
+        columns[0].appendInt(rank++);
+        columns[1].appendString(teamID);
+        columns[2].appendDouble(contestant->getScoreContest());
+        columns[3].appendDouble(contestant->getScoreHomework());
+        columns[4].appendDouble(contestant->getScoreUpsolved());
+        columns[5].appendDouble(contestant->getScoreBonus());
+        columns[6].appendDouble(contestant->getTotalScore());
+
+        size_t c = 7;
+        if (rated) {
+            columns[c++].appendDouble(scoreboard.getRatings().getRating(teamID));
+        }
+
+        const auto& scores = contestant->getContestScores();
+        for (const auto& contestId : contestIds) {
+            auto it = scores.find(contestId);
+            if (it == scores.end()) {
+                columns[c++].appendNull();
+                columns[c++].appendNull();
+                columns[c++].appendNull();
+            } else {
+                columns[c++].appendDouble(toDouble(it->second.solve));
+                columns[c++].appendDouble(toDouble(it->second.bonus));
+                columns[c++].appendDouble(toDouble(it->second.upsolve));
+            }
+        }
+    }
+
+    exportColumns(std::move(columns), static_cast<int64_t>(ranking.size()),
+                  schema, array);
+}
+
+void exportContest(const Contest& contest, ArrowSchema* schema,
+                   ArrowArray* array) {
+    std::vector<std::pair<const std::string*, const Performance*>> rows;
+    for (const auto& [teamID, performance] : contest.getPerformances()) {
+        rows.push_back({&teamID, &performance});
+    }
+    std::stable_sort(rows.begin(), rows.end(), [](const auto& a, const auto& b) {
+        return a.second->getRank() < b.second->getRank();
+    });
+
+    std::vector<Column> columns;
+    columns.push_back(makeColumn("rank", "i"));
+    columns.push_back(makeColumn("team_id", "u"));
+    columns.push_back(makeColumn("penalty", "i"));
+    columns.push_back(makeColumn("solved", "i"));
+    columns.push_back(makeColumn("attempted", "i"));
+    columns.push_back(makeColumn("upsolved", "i"));
+    columns.push_back(makeColumn("bonus", "g"));
+
+    for (const auto& [teamID, performance] : rows) {
+        columns[0].appendInt(performance->getRank());
+        columns[1].appendString(*teamID);
+        columns[2].appendInt(performance->getPenalty());
+        columns[3].appendInt(performance->getProblemsSolved());
+        columns[4].appendInt(performance->getProblemsAttempted());
+        columns[5].appendInt(performance->getProblemsUpsolved());
+        columns[6].appendDouble(toDouble(performance->getBonusScore()));
+    }
+
+    exportColumns(std::move(columns), static_cast<int64_t>(rows.size()), schema,
+                  array);
+}
+
+}  // namespace MaratonaScore
@@ -0,0 +1,439 @@
+//    Copyright 2025 MaratonaCIn
+//
+//    Licensed under the Apache License, Version 2.0 (the "License");
+//    you may not use this file except in compliance with the License.
+//    You may obtain a copy of the License at
+//
+//        http://www.apache.org/licenses/LICENSE-2.0
+//
+//    Unless required by applicable law or agreed to in writing, software
+//    distributed under the License is distributed on an "AS IS" BASIS,
+//    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//    See the License for the specific language governing permissions and
+//    limitations under the License.
+
+
+#include "output/SharedScoreboard.hpp"
+
+#include <algorithm>
+#include <atomic>
+#include <cstring>
+#include <stdexcept>
+#include <thread>
+
+#ifdef _WIN32
+#ifndef NOMINMAX
+#define NOMINMAX
+#endif
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+#include "score/FixedPoint.hpp"
+
+namespace MaratonaScore {
+
+namespace {
+
+constexpr size_t HEADER_SIZE = (sizeof(SharedHeader) + 7) & ~size_t(7);
+
+std::string segmentName(const std::string& name) {
+#ifdef _WIN32
+    return "Local\\" + name;
+#else
+    std::string segment = name.empty() || name[0] != '/' ? "/" + name : name;
+#ifdef __APPLE__
+    // PSHMNAMLEN: longer names fail in shm_open with a vague ENAMETOOLONG
+    if (segment.size() > 31) {
+        throw std::invalid_argument(
+            "Shared memory names are limited to 31 characters on macOS: " +
+            segment);
+    }
+#endif
+    return segment;
+#endif
+}
+
+const SharedHeader* headerOf(const char* base) {
+    return reinterpret_cast<const SharedHeader*>(base);
+}
+
+std::atomic_ref<uint64_t> sequenceOf(const char* base) {
+    return std::atomic_ref<uint64_t>(
+        const_cast<SharedHeader*>(headerOf(base))->sequence);
+}
+
+bool hasLayout(const char* base, size_t size) {
+    return size >= HEADER_SIZE &&
+           std::memcmp(headerOf(base)->magic, SHARED_MAGIC, 8) == 0 &&
+           headerOf(base)->layoutVersion == SHARED_LAYOUT_VERSION;
+}
+
+void writeHeader(char* base, uint64_t sequence) {
+    SharedHeader header{};
+    std::memcpy(header.magic, SHARED_MAGIC, 8);
+    header.layoutVersion = SHARED_LAYOUT_VERSION;
+    header.headerSize = HEADER_SIZE;
+    header.sequence = sequence;
+    header.scoreScale = SCORE_SCALE;
+    header.rowSize = sizeof(SharedRow);
+    header.rowsOffset = HEADER_SIZE;
+    header.stringsOffset = HEADER_SIZE;
+    std::memcpy(base, &header, sizeof(header));
+}
+
+}  // namespace
+
+SharedStandingsView::SharedStandingsView(const char* base, size_t size)
+    : base(base) {
+    if (size < HEADER_SIZE) return;
+
+    const SharedHeader* header = headerOf(base);
+    uint64_t rowsEnd =
+        header->rowsOffset + uint64_t(header->rowCount) * sizeof(SharedRow);
+    uint64_t stringsEnd = header->stringsOffset + header->stringsSize;
+    if (header->rowSize != sizeof(SharedRow) || header->rowsOffset < HEADER_SIZE ||
+        rowsEnd > size || stringsEnd > size ||
+        header->stringsOffset > stringsEnd) {
+        return;
+    }
+
+    rows = reinterpret_cast<const SharedRow*>(base + header->rowsOffset);
+    strings = base + header->stringsOffset;
+    rowCount = header->rowCount;
+    stringsSize = header->stringsSize;
+    rated = header->rated != 0;
+}
+
+uint32_t SharedStandingsView::size() const {
+    return rowCount;
+}
+
+bool SharedStandingsView::isRated() const {
+    return rated;
+}
+
+const SharedRow& SharedStandingsView::row(uint32_t index) const {
+    return rows[index];
+}
+
+std::string_view SharedStandingsView::teamID(uint32_t index) const {
+    const SharedRow& r = rows[index];
+    if (uint64_t(r.teamIDOffset) + r.teamIDLength > stringsSize) return {};
+    return {strings + r.teamIDOffset, r.teamIDLength};
+}
+
+uint64_t SharedScoreboard::publish(const StandingsSnapshot& snapshot) {
+    const std::vector<StandingsRow>& rows = snapshot.getRows();
+
+    uint64_t stringsSize = 0;
+    for (const StandingsRow& row : rows) stringsSize += row.teamID.size();
+    const uint64_t stringsOffset = HEADER_SIZE + rows.size() * sizeof(SharedRow);
+    const uint64_t needed = stringsOffset + stringsSize;
+    if (stringsSize > UINT32_MAX) {
+        throw std::runtime_error("Scoreboard too large for shared memory");
+    }
+
+    // Growing leaves the published bytes as they are, so readers that still
+    // map the old size keep reading a valid snapshot
+    if (needed > length) {
+        map(std::max<size_t>(needed, length * 2));
+    }
+
+    std::atomic_ref<uint64_t> sequence = sequenceOf(base);
+    uint64_t current = sequence.load(std::memory_order_relaxed);
+    current += current & 1;  // a writer died mid-publication
+
+    sequence.store(current + 1, std::memory_order_relaxed);
+    std::atomic_thread_fence(std::memory_order_release);
+
+    SharedHeader* header = reinterpret_cast<SharedHeader*>(base);
+    header->segmentSize = length;
+    header->rowCount = static_cast<uint32_t>(rows.size());
+    header->rated = snapshot.isRated() ? 1 : 0;
+    header->rowsOffset = HEADER_SIZE;
+    header->stringsOffset = stringsOffset;
+    header->stringsSize = stringsSize;
+
+    SharedRow* out = reinterpret_cast<SharedRow*>(base + HEADER_SIZE);
+    char* strings = base + stringsOffset;
+    uint32_t offset = 0;
+    for (const StandingsRow& row : rows) {
+        *out++ = {row.contest,
+                  row.homework,
+                  row.upsolved,
+                  row.bonus,
+                  row.total,
+                  row.rating,
+                  static_cast<uint32_t>(row.rank),
+                  offset,
+                  static_cast<uint32_t>(row.teamID.size()),
+                  0};
+        std::memcpy(strings + offset, row.teamID.data(), row.teamID.size());
+        offset += static_cast<uint32_t>(row.teamID.size());
+    }
+
+    sequence.store(current + 2, std::memory_order_release);
+    return (current + 2) / 2;
+}
+
+uint64_t SharedScoreboardReader::generation() const {
+    return sequenceOf(base).load(std::memory_order_acquire) / 2;
+}
+
+uint64_t SharedScoreboardReader::beginRead() {
+    for (;;) {
+        uint64_t sequence = sequenceOf(base).load(std::memory_order_acquire);
+        if (sequence & 1) {
+            std::this_thread::yield();
+        } else if (headerOf(base)->segmentSize > length) {
+            map();  // the writer grew the segment
+        } else {
+            return sequence;
+        }
+    }
+}
+
+bool SharedScoreboardReader::endRead(uint64_t sequence) const {
+    std::atomic_thread_fence(std::memory_order_acquire);
+    return sequenceOf(base).load(std::memory_order_relaxed) == sequence;
+}
+
+#ifdef _WIN32
+
+SharedScoreboard::SharedScoreboard(const std::string& name, size_t capacity)
+    : name(segmentName(name)) {
+    capacity = std::max(capacity, HEADER_SIZE);
+    mapping = CreateFileMappingA(
+        INVALID_HANDLE_VALUE, nullptr, PAGE_READWRITE,
+        static_cast<DWORD>(uint64_t(capacity) >> 32),
+        static_cast<DWORD>(capacity & 0xFFFFFFFF), this->name.c_str());
+    if (!mapping) {
+        throw std::runtime_error("Could not create shared memory: " + name);
+    }
+    const bool existed = GetLastError() == ERROR_ALREADY_EXISTS;
+
+    base = static_cast<char*>(MapViewOfFile(mapping, FILE_MAP_ALL_ACCESS, 0, 0, 0));
+    if (!base) {
+        CloseHandle(mapping);
+        throw std::runtime_error("Could not map shared memory: " + name);
+    }
+
+    length = existed && hasLayout(base, HEADER_SIZE)
+                 ? static_cast<size_t>(headerOf(base)->segmentSize)
+                 : capacity;
+    if (!existed || !hasLayout(base, length)) {
+        writeHeader(base, 0);
+        reinterpret_cast<SharedHeader*>(base)->segmentSize = length;
+    }
+}
+
+SharedScoreboard::~SharedScoreboard() {
+    if (base) UnmapViewOfFile(base);
+    if (mapping) CloseHandle(mapping);
+}
+
+void SharedScoreboard::map(size_t) {
+    // Named mappings have a fixed size
+    throw std::runtime_error("Scoreboard does not fit in shared memory " +
+                             name + ", create it with a larger capacity");
+}
+
+void SharedScoreboard::remove(const std::string&) {
+    // The mapping goes away with its last handle
+}
+
+SharedScoreboardReader::SharedScoreboardReader(const std::string& name)
+    : name(segmentName(name)) {
+    mapping = OpenFileMappingA(FILE_MAP_READ, FALSE, this->name.c_str());
+    if (!mapping) {
+        throw std::runtime_error("Scoreboard not published: " + name);
+    }
+    map();
+}
+
+SharedScoreboardReader::~SharedScoreboardReader() {
+    if (base) UnmapViewOfFile(base);
+    if (mapping) CloseHandle(mapping);
+}
+
+void SharedScoreboardReader::map() {
+    if (base) UnmapViewOfFile(base);
+    base = static_cast<const char*>(MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0));
+    if (!base) {
+        throw std::runtime_error("Could not map shared memory: " + name);
+    }
+
+    MEMORY_BASIC_INFORMATION info;
+    VirtualQuery(base, &info, sizeof(info));
+    length = info.RegionSize;
+    if (!hasLayout(base, length)) {
+        throw std::runtime_error("Not a published scoreboard: " + name);
+    }
+    length = std::min<size_t>(length, headerOf(base)->segmentSize);
+}
+
+#else
+
+SharedScoreboard::SharedScoreboard(const std::string& name, size_t capacity)
+    : name(segmentName(name)) {
+    fd = shm_open(this->name.c_str(), O_CREAT | O_RDWR, 0644);
+    if (fd < 0) {
+        throw std::runtime_error("Could not create shared memory: " + name);
+    }
+
+    map(std::max(capacity, HEADER_SIZE));
+
+    // Keep the sequence of an earlier writer so generations stay monotonic
+    if (!hasLayout(base, length)) writeHeader(base, 0);
+    reinterpret_cast<SharedHeader*>(base)->segmentSize = length;
+}
+
+SharedScoreboard::~SharedScoreboard() {
+    if (base) munmap(base, length);
+    if (fd >= 0) close(fd);
+}
+
+// Maps at least `size` bytes. A new object is sized once; an existing one
+// is mapped at its size, or grown. macOS refuses ftruncate on a shm object
+// that already has a size, so there the object is replaced under the same
+// name: the old header announces the new size (readers then reopen it by
+// name) and the new one carries the sequence on.
+void SharedScoreboard::map(size_t size) {
+    struct stat st;
+    if (fstat(fd, &st) != 0) {
+        throw std::runtime_error("Could not stat shared memory: " + name);
+    }
+    const size_t current = static_cast<size_t>(st.st_size);
+
+    bool replaced = false;
+    uint64_t sequence = 0;
+    if (current == 0) {
+        // A new object: the one ftruncate every platform accepts
+        if (ftruncate(fd, static_cast<off_t>(size)) != 0) {
+            throw std::runtime_error("Could not resize shared memory: " + name);
+        }
+    } else if (current >= size) {
+        size = current;
+    } else {
+#ifdef __APPLE__
+        if (!base) {
+            // Opening an existing segment: use it as it is, and replace it
+            // on the first publication that needs more room.
+            if (current < HEADER_SIZE) {
+                throw std::runtime_error("Shared memory " + name +
+                                         " is too small; remove it first");
+            }
+            size = current;
+        } else {
+            sequence = sequenceOf(base).load(std::memory_order_relaxed);
+            reinterpret_cast<SharedHeader*>(base)->segmentSize = size;
+
+            shm_unlink(name.c_str());
+            close(fd);
+            fd = shm_open(name.c_str(), O_CREAT | O_RDWR, 0644);
+            if (fd < 0 || ftruncate(fd, static_cast<off_t>(size)) != 0) {
+                throw std::runtime_error("Could not resize shared memory: " +
+                                         name);
+            }
+            replaced = true;
+        }
+#else
+        if (ftruncate(fd, static_cast<off_t>(size)) != 0) {
+            throw std::runtime_error("Could not resize shared memory: " + name);
+        }
+#endif
+    }
+    if (base) munmap(base, length);
+
+    void* address =
+        mmap(nullptr, size, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+    if (address == MAP_FAILED) {
+        base = nullptr;
+        throw std::runtime_error("Could not map shared memory: " + name);
+    }
+    base = static_cast<char*>(address);
+    length = size;
+
+    if (replaced) {
+        writeHeader(base, sequence);
+        reinterpret_cast<SharedHeader*>(base)->segmentSize = length;
+    }
+}
+
+void SharedScoreboard::remove(const std::string& name) {
+    shm_unlink(segmentName(name).c_str());
+}
+
+SharedScoreboardReader::SharedScoreboardReader(const std::string& name)
+    : name(segmentName(name)) {
+    fd = shm_open(this->name.c_str(), O_RDONLY, 0);
+    if (fd < 0) {
+        throw std::runtime_error("Scoreboard not published: " + name);
+    }
+    map();
+}
+
+SharedScoreboardReader::~SharedScoreboardReader() {
+    if (base) munmap(const_cast<char*>(base), length);
+    if (fd >= 0) close(fd);
+}
+
+void SharedScoreboardReader::map() {
+    struct stat st;
+    if (fstat(fd, &st) != 0) {
+        throw std::runtime_error("Could not stat shared memory: " + name);
+    }
+
+    // Asked to remap but the object did not grow: the writer replaced it
+    // under the same name (macOS). Switch once the new one is published.
+    if (base && static_cast<size_t>(st.st_size) <= length) {
+        int next = shm_open(name.c_str(), O_RDONLY, 0);
+        struct stat nextStat;
+        void* address = MAP_FAILED;
+        if (next >= 0 && fstat(next, &nextStat) == 0 &&
+            static_cast<size_t>(nextStat.st_size) >= HEADER_SIZE) {
+            address = mmap(nullptr, static_cast<size_t>(nextStat.st_size),
+                           PROT_READ, MAP_SHARED, next, 0);
+        }
+        if (address == MAP_FAILED ||
+            !hasLayout(static_cast<const char*>(address),
+                       static_cast<size_t>(nextStat.st_size))) {
+            if (address != MAP_FAILED) {
+                munmap(address, static_cast<size_t>(nextStat.st_size));
+            }
+            if (next >= 0) close(next);
+            std::this_thread::yield();
+            return;
+        }
+
+        munmap(const_cast<char*>(base), length);
+        close(fd);
+        fd = next;
+        base = static_cast<const char*>(address);
+        length = static_cast<size_t>(nextStat.st_size);
+        return;
+    }
+
+    if (base) munmap(const_cast<char*>(base), length);
+    base = nullptr;
+
+    length = static_cast<size_t>(st.st_size);
+    void* address = mmap(nullptr, length, PROT_READ, MAP_SHARED, fd, 0);
+    if (address == MAP_FAILED) {
+        throw std::runtime_error("Could not map shared memory: " + name);
+    }
+    base = static_cast<const char*>(address);
+
+    if (!hasLayout(base, length)) {
+        throw std::runtime_error("Not a published scoreboard: " + name);
+    }
+}
+
+#endif
+
+}  // namespace MaratonaScore
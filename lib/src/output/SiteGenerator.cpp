@@ -0,0 +1,563 @@
+//    Copyright 2025 MaratonaCIn
+//
+//    Licensed under the Apache License, Version 2.0 (the "License");
+//    you may not use this file except in compliance with the License.
+//    You may obtain a copy of the License at
+//
+//        http://www.apache.org/licenses/LICENSE-2.0
+//
+//    Unless required by applicable law or agreed to in writing, software
+//    distributed under the License is distributed on an "AS IS" BASIS,
+//    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//    See the License for the specific language governing permissions and
+//    limitations under the License.
+
+#include "output/SiteGenerator.hpp"
+
+#include <zlib.h>
+
+#include <algorithm>
+#include <atomic>
+#include <cctype>
+#include <charconv>
+#include <cstdint>
+#include <exception>
+#include <filesystem>
+#include <fstream>
+#include <functional>
+#include <stdexcept>
+#include <string_view>
+#include <thread>
+#include <unordered_map>
+#include <unordered_set>
+
+#include "score/FixedPoint.hpp"
+#include "utils/Blacklist.hpp"
+#include "utils/Settings.hpp"
+#include "utils/StringUtils.hpp"
+
+namespace MaratonaScore {
+
+namespace fs = std::filesystem;
+
+namespace {
+
+constexpr const char* MANIFEST = ".site-manifest";
+
+constexpr const char* STYLE =
+    "body{font-family:sans-serif;margin:2em;color:#222}\n"
+    "table{border-collapse:collapse;margin-bottom:1.5em}\n"
+    "th,td{border:1px solid #ccc;padding:.25em .6em;text-align:center}\n"
+    "td.name{text-align:left}\n"
+    "td.solved{background:#c8f0c8}\n"
+    "td.attempted{background:#f6c8c8}\n"
+    "td.upsolved{background:#f6ecb8}\n"
+    "tr.dropped{color:#999;text-decoration:line-through}\n"
+    "small{display:block;color:#555}\n";
+
+struct ContestInfo {
+    const Contest* contest;
+    std::string slug;
+    std::vector<std::string> problems;     // A, B, ..., Z, AA, ...
+    std::vector<const std::string*> order;  // team IDs by rank
+};
+
+struct Page {
+    std::string path;  // relative to outputDir, '/' separated
+    std::function<std::string()> render;
+    uint64_t hash = 0;
+    bool written = false;
+};
+
+std::string gzip(std::string_view data) {
+    z_stream stream{};
+    // windowBits 15 + 16 writes a gzip wrapper; the header mtime stays 0, so
+    // unchanged pages compress to identical files.
+    if (deflateInit2(&stream, Z_BEST_COMPRESSION, Z_DEFLATED, 15 + 16, 8,
+                     Z_DEFAULT_STRATEGY) != Z_OK) {
+        throw std::runtime_error("Could not initialize gzip stream");
+    }
+    std::string out(deflateBound(&stream, static_cast<uLong>(data.size())),
+                    '\0');
+    stream.next_in =
+        reinterpret_cast<Bytef*>(const_cast<char*>(data.data()));
+    stream.avail_in = static_cast<uInt>(data.size());
+    stream.next_out = reinterpret_cast<Bytef*>(out.data());
+    stream.avail_out = static_cast<uInt>(out.size());
+    int result = deflate(&stream, Z_FINISH);
+    out.resize(stream.total_out);
+    deflateEnd(&stream);
+    if (result != Z_STREAM_END) {
+        throw std::runtime_error("Could not gzip page");
+    }
+    return out;
+}
+
+void writeFile(const fs::path& path, std::string_view data) {
+    std::ofstream out(path, std::ios::binary | std::ios::trunc);
+    out.write(data.data(), static_cast<std::streamsize>(data.size()));
+    if (!out) {
+        throw std::runtime_error("Could not write " + path.string());
+    }
+}
+
+void appendScore(std::string& out, ScoreValue value) {
+    char buffer[32];
+    auto result = std::to_chars(buffer, buffer + sizeof(buffer),
+                                toDouble(value), std::chars_format::fixed, 2);
+    out.append(buffer, result.ptr);
+}
+
+void appendNumber(std::string& out, double value, int precision) {
+    char buffer[64];
+    auto result = std::to_chars(buffer, buffer + sizeof(buffer), value,
+                                std::chars_format::fixed, precision);
+    out.append(buffer, result.ptr);
+}
+
+void beginPage(std::string& out, const std::string& siteTitle,
+               std::string_view title, std::string_view root) {
+    out += "<!DOCTYPE html>\n<html lang=\"en\">\n<head>\n"
+           "<meta charset=\"utf-8\">\n<title>";
+    appendEscaped(out, title);
+    out += " - ";
+    appendEscaped(out, siteTitle);
+    out += "</title>\n<link rel=\"stylesheet\" href=\"";
+    out += root;
+    out += "style.css\">\n</head>\n<body>\n";
+    if (!root.empty()) {
+        out += "<p><a href=\"";
+        out += root;
+        out += "index.html\">";
+        appendEscaped(out, siteTitle);
+        out += "</a></p>\n";
+    }
+    out += "<h1>";
+    appendEscaped(out, title);
+    out += "</h1>\n";
+}
+
+void endPage(std::string& out) { out += "</body>\n</html>\n"; }
+
+void appendLink(std::string& out, std::string_view href,
+                std::string_view text) {
+    out += "<a href=\"";
+    out += href;
+    out += "\">";
+    appendEscaped(out, text);
+    out += "</a>";
+}
+
+void appendCell(std::string& out, const ProblemStatus* status) {
+    if (!status) {
+        out += "<td></td>";
+        return;
+    }
+    switch (status->getStatus()) {
+        case SOLVED:
+            out += "<td class=\"solved\">+";
+            if (status->getAttempts() > 0) {
+                out += std::to_string(status->getAttempts());
+            }
+            out += "<small>";
+            out += std::to_string(status->getTimeTaken());
+            out += "</small></td>";
+            break;
+        case ATTEMPTED:
+            out += "<td class=\"attempted\">-";
+            out += std::to_string(status->getAttempts());
+            out += "</td>";
+            break;
+        case UPSOLVED:
+            out += "<td class=\"upsolved\">*</td>";
+            break;
+        default:
+            out += "<td></td>";
+    }
+}
+
+// Problem cells of one performance, in the column order of the contest.
+void appendProblemCells(std::string& out, const ContestInfo& info,
+                        const Performance& performance) {
+    const auto& problems = performance.getProblems();
+    for (const std::string& problem : info.problems) {
+        auto it = problems.find(problem);
+        appendCell(out, it == problems.end() ? nullptr : &it->second);
+    }
+}
+
+void appendProblemHeader(std::string& out, const ContestInfo& info) {
+    for (const std::string& problem : info.problems) {
+        out += "<th>";
+        appendEscaped(out, problem);
+        out += "</th>";
+    }
+}
+
+std::string roundTitle(const Contest& contest) {
+    return (contest.getType() == HOMEWORK ? "Homework " : "Contest ") +
+           contest.getId();
+}
+
+ContestInfo buildContestInfo(const Contest& contest) {
+    ContestInfo info{&contest, pageSlug(contest.getId()), {}, {}};
+
+    std::unordered_set<std::string> seen;
+    for (const auto& [teamID, performance] : contest.getPerformances()) {
+        // The finals are not filtered by their parser; nothing blacklisted
+        // is published.
+        if (Blacklist::isBlacklisted(teamID)) continue;
+        info.order.push_back(&teamID);
+        for (const auto& [problem, status] : performance.getProblems()) {
+            if (seen.insert(problem).second) info.problems.push_back(problem);
+        }
+    }
+    std::sort(info.problems.begin(), info.problems.end(),
+              [](const std::string& a, const std::string& b) {
+                  return a.size() != b.size() ? a.size() < b.size() : a < b;
+              });
+
+    const auto& performances = contest.getPerformances();
+    std::stable_sort(info.order.begin(), info.order.end(),
+                     [&](const std::string* a, const std::string* b) {
+                         return performances.at(*a).getRank() <
+                                performances.at(*b).getRank();
+                     });
+    return info;
+}
+
+std::string renderIndex(const Scoreboard& scoreboard,
+                        const std::vector<ContestInfo>& contests,
+                        const SiteOptions& options) {
+    const bool rated = Settings::getInstance().RATING_ENABLED;
+
+    std::string out;
+    beginPage(out, options.title, "Standings", "");
+
+    out += "<table>\n<tr><th>Rank</th><th>Team ID</th><th>Contest</th>"
+           "<th>Homework</th><th>Upsolved</th><th>Bonus</th><th>Overall</th>";
+    if (rated) out += "<th>Rating</th>";
+    out += "</tr>\n";
+
+    int rank = 1;
+    for (const auto& [teamID, contestant] : scoreboard.getRanking()) {
+        out += "<tr><td>";
+        out += std::to_string(rank++);
+        out += "</td><td class=\"name\">";
+        appendLink(out, "contestants/" + pageSlug(teamID) + ".html", teamID);
+        for (double value :
+             {contestant->getScoreContest(), contestant->getScoreHomework(),
+              contestant->getScoreUpsolved(), contestant->getScoreBonus(),
+              contestant->getTotalScore()}) {
+            out += "</td><td>";
+            appendNumber(out, value, 2);
+        }
+        if (rated) {
+            out += "</td><td>";
+            if (scoreboard.getRatings().hasRating(teamID)) {
+                appendNumber(out, scoreboard.getRatings().getRating(teamID), 0);
+            }
+        }
+        out += "</td></tr>\n";
+    }
+    out += "</table>\n";
+
+    if (!contests.empty()) {
+        out += "<h2>Rounds</h2>\n<ul>\n";
+        for (const ContestInfo& info : contests) {
+            out += "<li>";
+            appendLink(out, "contests/" + info.slug + ".html",
+                       roundTitle(*info.contest));
+            out += "</li>\n";
+        }
+        out += "</ul>\n";
+    }
+
+    endPage(out);
+    return out;
+}
+
+std::string renderContestant(
+    const Scoreboard& scoreboard, const std::string& teamID,
+    const std::vector<ContestInfo>& contests,
+    const std::unordered_map<std::string, const ContestInfo*>& byId,
+    const SiteOptions& options) {
+    Explanation explanation = scoreboard.explain(teamID);
+
+    std::string out;
+    beginPage(out, options.title, teamID, "../");
+
+    out += "<table>\n<tr><th>Round</th><th>Solved</th><th>Upsolved</th>"
+           "<th>Solve</th><th>Bonus</th><th>Upsolve</th></tr>\n";
+    for (const ContestBreakdown& round : explanation.contests) {
+        out += round.dropped ? "<tr class=\"dropped\"><td>" : "<tr><td>";
+        auto it = byId.find(round.contestId);
+        if (it != byId.end()) {
+            appendLink(out, "../contests/" + it->second->slug + ".html",
+                       round.contestId);
+        } else {
+            appendEscaped(out, round.contestId);
+        }
+        out += "</td><td>";
+        out += std::to_string(round.solved);
+        out += "</td><td>";
+        out += std::to_string(round.upsolved);
+        for (ScoreValue value : {round.solve, round.bonus, round.upsolve}) {
+            out += "</td><td>";
+            appendScore(out, value);
+        }
+        out += "</td></tr>\n";
+    }
+    out += "<tr><th>Overall</th><td colspan=\"5\">";
+    appendScore(out, explanation.totalScore);
+    out += "</td></tr>\n</table>\n";
+
+    for (const ContestInfo& info : contests) {
+        const auto& performances = info.contest->getPerformances();
+        auto it = performances.find(teamID);
+        if (it == performances.end()) continue;
+        const Performance& performance = it->second;
+
+        out += "<h2>";
+        appendLink(out, "../contests/" + info.slug + ".html",
+                   roundTitle(*info.contest));
+        out += "</h2>\n<table>\n<tr><th>Rank</th><th>Solved</th>"
+               "<th>Penalty</th>";
+        appendProblemHeader(out, info);
+        out += "</tr>\n<tr><td>";
+        out += std::to_string(performance.getRank());
+        out += "</td><td>";
+        out += std::to_string(performance.getProblemsSolved());
+        out += "</td><td>";
+        out += std::to_string(performance.getPenalty());
+        out += "</td>";
+        appendProblemCells(out, info, performance);
+        out += "</tr>\n</table>\n";
+    }
+
+    endPage(out);
+    return out;
+}
+
+std::string renderContest(const ContestInfo& info,
+                          const std::unordered_set<std::string>& ranked,
+                          const SiteOptions& options) {
+    const auto& performances = info.contest->getPerformances();
+
+    std::string out;
+    beginPage(out, options.title, roundTitle(*info.contest), "../");
+
+    out += "<table>\n<tr><th>Rank</th><th>Team ID</th><th>Solved</th>"
+           "<th>Penalty</th>";
+    appendProblemHeader(out, info);
+    out += "</tr>\n";
+    for (const std::string* teamID : info.order) {
+        const Performance& performance = performances.at(*teamID);
+        out += "<tr><td>";
+        out += std::to_string(performance.getRank());
+        out += "</td><td class=\"name\">";
+        if (ranked.count(*teamID)) {
+            appendLink(out, "../contestants/" + pageSlug(*teamID) + ".html",
+                       *teamID);
+        } else {
+            appendEscaped(out, *teamID);
+        }
+        out += "</td><td>";
+        out += std::to_string(performance.getProblemsSolved());
+        out += "</td><td>";
+        out += std::to_string(performance.getPenalty());
+        out += "</td>";
+        appendProblemCells(out, info, performance);
+        out += "</tr>\n";
+    }
+    out += "</table>\n";
+
+    endPage(out);
+    return out;
+}
+
+std::unordered_map<std::string, uint64_t> readManifest(const fs::path& path) {
+    std::unordered_map<std::string, uint64_t> manifest;
+    std::ifstream in(path);
+    std::string hash, page;
+    while (in >> hash >> page) {
+        manifest[page] = std::stoull(hash, nullptr, 16);
+    }
+    return manifest;
+}
+
+void writeManifest(const fs::path& path, const std::vector<Page>& pages) {
+    std::string out;
+    char buffer[17];
+    for (const Page& page : pages) {
+        auto result = std::to_chars(buffer, buffer + 16, page.hash, 16);
+        out.append(16 - (result.ptr - buffer), '0');
+        out.append(buffer, result.ptr);
+        out += ' ';
+        out += page.path;
+        out += '\n';
+    }
+    fs::path temp = path;
+    temp += ".tmp";
+    writeFile(temp, out);
+    fs::rename(temp, path);
+}
+
+// Only pages this generator could have written are removed, whatever the
+// manifest says.
+bool isPagePath(const std::string& path) {
+    size_t slash = path.find('/');
+    if (slash == std::string::npos) return false;
+    std::string_view dir(path.data(), slash);
+    std::string_view name(path.data() + slash + 1, path.size() - slash - 1);
+    if ((dir != "contestants" && dir != "contests") || name.size() <= 5 ||
+        name.substr(name.size() - 5) != ".html") {
+        return false;
+    }
+    name.remove_suffix(5);
+    return std::all_of(name.begin(), name.end(), [](char ch) {
+        return std::isalnum(static_cast<unsigned char>(ch)) || ch == '-' ||
+               ch == '_' || ch == '~';
+    });
+}
+
+}  // namespace
+
+std::string pageSlug(const std::string& id) {
+    static const char* HEX = "0123456789ABCDEF";
+    std::string slug;
+    slug.reserve(id.size());
+    for (unsigned char ch : id) {
+        if ((ch >= 'a' && ch <= 'z') || (ch >= 'A' && ch <= 'Z') ||
+            (ch >= '0' && ch <= '9') || ch == '-' || ch == '_') {
+            slug += static_cast<char>(ch);
+        } else {
+            slug += '~';
+            slug += HEX[ch >> 4];
+            slug += HEX[ch & 15];
+        }
+    }
+    return slug;
+}
+
+SiteReport generateSite(const Scoreboard& scoreboard,
+                        const std::vector<Contest>& contests,
+                        const std::string& outputDir,
+                        const SiteOptions& options) {
+    const fs::path root(outputDir);
+    fs::create_directories(root / "contestants");
+    fs::create_directories(root / "contests");
+
+    std::vector<ContestInfo> infos;
+    std::unordered_map<std::string, const ContestInfo*> byId;
+    infos.reserve(contests.size());
+    for (const Contest& contest : contests) {
+        infos.push_back(buildContestInfo(contest));
+    }
+    for (const ContestInfo& info : infos) {
+        byId.emplace(info.contest->getId(), &info);
+    }
+
+    // Blacklisted contestants get no page, and no links to one.
+    const auto ranking = scoreboard.getRanking();
+    std::unordered_set<std::string> ranked;
+    for (const auto& [teamID, contestant] : ranking) {
+        ranked.insert(teamID);
+    }
+
+    std::vector<Page> pages;
+    pages.push_back({"style.css", [] { return std::string(STYLE); }});
+    pages.push_back(
+        {"index.html", [&] { return renderIndex(scoreboard, infos, options); }});
+    for (const auto& [teamID, contestant] : ranking) {
+        pages.push_back({"contestants/" + pageSlug(teamID) + ".html",
+                         [&, id = &teamID] {
+                             return renderContestant(scoreboard, *id, infos,
+                                                     byId, options);
+                         }});
+    }
+    for (const ContestInfo& info : infos) {
+        pages.push_back({"contests/" + info.slug + ".html", [&, in = &info] {
+                             return renderContest(*in, ranked, options);
+                         }});
+    }
+
+    const auto previous = readManifest(root / MANIFEST);
+
+    // Each worker renders, hashes and (when the hash differs from the last
+    // run or the file is missing) writes the next unclaimed page.
+    std::atomic<size_t> next{0};
+    auto work = [&]() {
+        for (size_t i = next++; i < pages.size(); i = next++) {
+            Page& page = pages[i];
+            std::string content = page.render();
+            page.hash = fnv1a(content);
+
+            const fs::path path = root / page.path;
+            fs::path compressed = path;
+            compressed += ".gz";
+
+            auto it = previous.find(page.path);
+            bool unchanged = it != previous.end() && it->second == page.hash &&
+                             fs::exists(path) &&
+                             (!options.gzip || fs::exists(compressed));
+            if (!options.gzip) {
+                std::error_code ec;
+                fs::remove(compressed, ec);
+            }
+            if (unchanged) continue;
+
+            writeFile(path, content);
+            if (options.gzip) writeFile(compressed, gzip(content));
+            page.written = true;
+        }
+    };
+
+    size_t threads = options.threads > 0
+                         ? static_cast<size_t>(options.threads)
+                         : std::max(1u, std::thread::hardware_concurrency());
+    threads = std::clamp<size_t>(threads, 1, pages.size());
+
+    std::vector<std::exception_ptr> errors(threads);
+    std::vector<std::thread> workers;
+    for (size_t t = 1; t < threads; ++t) {
+        workers.emplace_back([&, t] {
+            try {
+                work();
+            } catch (...) {
+                errors[t] = std::current_exception();
+            }
+        });
+    }
+    try {
+        work();
+    } catch (...) {
+        errors[0] = std::current_exception();
+    }
+    for (auto& worker : workers) worker.join();
+    for (const auto& error : errors) {
+        if (error) std::rethrow_exception(error);
+    }
+
+    SiteReport report;
+    report.pages = static_cast<int>(pages.size());
+
+    std::unordered_set<std::string> current;
+    for (const Page& page : pages) {
+        current.insert(page.path);
+        if (page.written) report.written++;
+    }
+    for (const auto& [path, hash] : previous) {
+        if (current.count(path) || !isPagePath(path)) continue;
+        std::error_code ec;
+        fs::path compressed = root / path;
+        compressed += ".gz";
+        fs::remove(compressed, ec);
+        if (fs::remove(root / path, ec)) report.removed++;
+    }
+
+    writeManifest(root / MANIFEST, pages);
+    return report;
+}
+
+}  // namespace MaratonaScore
@@ -0,0 +1,219 @@
+//    Copyright 2025 MaratonaCIn
+//
+//    Licensed under the Apache License, Version 2.0 (the "License");
+//    you may not use this file except in compliance with the License.
+//    You may obtain a copy of the License at
+//
+//        http://www.apache.org/licenses/LICENSE-2.0
+//
+//    Unless required by applicable law or agreed to in writing, software
+//    distributed under the License is distributed on an "AS IS" BASIS,
+//    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//    See the License for the specific language governing permissions and
+//    limitations under the License.
+
+
+#include "output/StandingsDelta.hpp"
+
+#include <fstream>
+#include <iomanip>
+#include <stdexcept>
+#include <unordered_map>
+
+#include "utils/Settings.hpp"
+
+namespace MaratonaScore {
+
+bool StandingsRow::sameValues(const StandingsRow& other) const {
+    return contest == other.contest && homework == other.homework &&
+           upsolved == other.upsolved && bonus == other.bonus &&
+           total == other.total && rating == other.rating;
+}
+
+StandingsSnapshot StandingsSnapshot::fromScoreboard(
+    const Scoreboard& scoreboard) {
+    StandingsSnapshot snapshot;
+    snapshot.rated = Settings::getInstance().RATING_ENABLED;
+
+    for (const auto& [teamID, contestant] : scoreboard.getRanking()) {
+        StandingsRow row;
+        row.teamID = teamID;
+        row.rank = static_cast<int>(snapshot.rows.size()) + 1;
+        row.contest = toFixed(contestant->getScoreContest());
+        row.homework = toFixed(contestant->getScoreHomework());
+        row.upsolved = toFixed(contestant->getScoreUpsolved());
+        row.bonus = toFixed(contestant->getScoreBonus());
+        row.total = contestant->getTotalScoreFixed();
+        if (snapshot.rated) {
+            row.rating = scoreboard.getRatings().getRating(teamID);
+        }
+        snapshot.rows.push_back(std::move(row));
+    }
+
+    return snapshot;
+}
+
+StandingsSnapshot StandingsSnapshot::fromScoreboard(
+    const StreamingScoreboard& scoreboard) {
+    StandingsSnapshot snapshot;
+    snapshot.rated = Settings::getInstance().RATING_ENABLED;
+
+    for (uint32_t index : scoreboard.getRanking()) {
+        StreamingScoreboard::Totals totals = scoreboard.getTotals(index);
+
+        StandingsRow row;
+        row.teamID = scoreboard.getTeamID(index);
+        row.rank = static_cast<int>(snapshot.rows.size()) + 1;
+        row.contest = totals.contest;
+        row.homework = totals.homework;
+        row.upsolved = totals.upsolved;
+        row.bonus = totals.bonus;
+        row.total = totals.total();
+        if (snapshot.rated) {
+            row.rating = scoreboard.getRatings().getRating(row.teamID);
+        }
+        snapshot.rows.push_back(std::move(row));
+    }
+
+    return snapshot;
+}
+
+StandingsSnapshot StandingsSnapshot::load(const std::string& path) {
+    std::ifstream in(path);
+    if (!in.is_open()) {
+        throw std::runtime_error("Could not open standings snapshot: " + path);
+    }
+
+    StandingsSnapshot snapshot;
+
+    std::string line;
+    std::getline(in, line);
+    if (!line.empty() && line.back() == '\r') line.pop_back();
+    snapshot.rated = line.size() >= 7 && line.substr(line.size() - 7) == ",Rating";
+    const int fields = snapshot.rated ? 7 : 6;
+
+    while (std::getline(in, line)) {
+        if (!line.empty() && line.back() == '\r') line.pop_back();
+        if (line.empty()) continue;
+
+        // Team IDs may contain commas, the numeric fields may not
+        std::vector<std::string> values(fields);
+        size_t end = line.size();
+        for (int i = fields - 1; i >= 0; i--) {
+            size_t comma = end == 0 ? std::string::npos : line.rfind(',', end - 1);
+            if (comma == std::string::npos || comma == 0) {
+                throw std::runtime_error("Malformed snapshot line: " + line);
+            }
+            values[i] = line.substr(comma + 1, end - comma - 1);
+            end = comma;
+        }
+
+        StandingsRow row;
+        row.teamID = line.substr(0, end);
+        row.rank = std::stoi(values[0]);
+        row.contest = std::stoll(values[1]);
+        row.homework = std::stoll(values[2]);
+        row.upsolved = std::stoll(values[3]);
+        row.bonus = std::stoll(values[4]);
+        row.total = std::stoll(values[5]);
+        if (snapshot.rated) row.rating = std::stod(values[6]);
+        snapshot.rows.push_back(std::move(row));
+    }
+
+    return snapshot;
+}
+
+void StandingsSnapshot::save(const std::string& path) const {
+    std::ofstream out(path);
+    if (!out.is_open()) {
+        throw std::runtime_error("Could not open standings snapshot: " + path);
+    }
+
+    out << "Team ID,Rank,Contest,Homework,Upsolved,Bonus,Overall"
+        << (rated ? ",Rating\n" : "\n") << std::setprecision(17);
+    for (const StandingsRow& row : rows) {
+        out << row.teamID << ',' << row.rank << ',' << row.contest << ','
+            << row.homework << ',' << row.upsolved << ',' << row.bonus << ','
+            << row.total;
+        if (rated) out << ',' << row.rating;
+        out << '\n';
+    }
+}
+
+bool StandingsSnapshot::isRated() const {
+    return rated;
+}
+
+const std::vector<StandingsRow>& StandingsSnapshot::getRows() const {
+    return rows;
+}
+
+StandingsDelta::StandingsDelta(const StandingsSnapshot& previous,
+                               const StandingsSnapshot& current)
+    : rated(current.isRated()) {
+    const std::vector<StandingsRow>& before = previous.getRows();
+    const std::vector<StandingsRow>& after = current.getRows();
+
+    std::unordered_map<std::string, uint32_t> interned;
+    interned.reserve(before.size());
+    for (uint32_t i = 0; i < before.size(); i++) {
+        interned.emplace(before[i].teamID, i);
+    }
+
+    std::vector<char> kept(before.size(), 0);
+    for (const StandingsRow& row : after) {
+        auto it = interned.find(row.teamID);
+        if (it == interned.end()) {
+            entries.push_back({DELTA_ADDED, &row, 0});
+            continue;
+        }
+
+        const StandingsRow& old = before[it->second];
+        kept[it->second] = 1;
+        if (!row.sameValues(old)) {
+            entries.push_back({DELTA_CHANGED, &row, old.rank});
+        } else if (row.rank != old.rank) {
+            entries.push_back({DELTA_MOVED, &row, old.rank});
+        }
+    }
+
+    for (uint32_t i = 0; i < before.size(); i++) {
+        if (!kept[i]) entries.push_back({DELTA_REMOVED, &before[i], before[i].rank});
+    }
+}
+
+const std::vector<DeltaEntry>& StandingsDelta::getEntries() const {
+    return entries;
+}
+
+bool StandingsDelta::empty() const {
+    return entries.empty();
+}
+
+void StandingsDelta::renderCSV(std::ostream& os) const {
+    static const char* OPS[] = {"added", "removed", "changed", "moved"};
+
+    os << "Op,Team ID,Rank,Previous Rank,Total Contest Score,Total Homework "
+          "Score,Total Upsolved Score,Bonus Score,Overall Score"
+       << (rated ? ",Rating\n" : "\n");
+
+    for (const DeltaEntry& entry : entries) {
+        const StandingsRow& row = *entry.row;
+        os << OPS[entry.op] << ',' << row.teamID << ',';
+        if (entry.op != DELTA_REMOVED) os << row.rank;
+        os << ',';
+        if (entry.op != DELTA_ADDED) os << entry.previousRank;
+
+        if (entry.op == DELTA_ADDED || entry.op == DELTA_CHANGED) {
+            os << ',' << toDouble(row.contest) << ',' << toDouble(row.homework)
+               << ',' << toDouble(row.upsolved) << ',' << toDouble(row.bonus)
+               << ',' << toDouble(row.total);
+            if (rated) os << ',' << row.rating;
+        } else {
+            os << ",,,,," << (rated ? "," : "");
+        }
+        os << '\n';
+    }
+}
+
+}  // namespace MaratonaScore
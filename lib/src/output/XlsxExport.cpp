@@ -0,0 +1,236 @@
+//    Copyright 2025 MaratonaCIn
+//
+//    Licensed under the Apache License, Version 2.0 (the "License");
+//    you may not use this file except in compliance with the License.
+//    You may obtain a copy of the License at
+//
+//        http://www.apache.org/licenses/LICENSE-2.0
+//
+//    Unless required by applicable law or agreed to in writing, software
+//    distributed under the License is distributed on an "AS IS" BASIS,
+//    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//    See the License for the specific language governing permissions and
+//    limitations under the License.
+
+
+#include "output/XlsxExport.hpp"
+
+#include <charconv>
+#include <cmath>
+#include <set>
+
+#include "score/FixedPoint.hpp"
+#include "utils/Settings.hpp"
+#include "utils/StringUtils.hpp"
+
+namespace MaratonaScore {
+
+namespace {
+
+constexpr size_t FLUSH_SIZE = 1 << 16;
+
+// Markup is escaped as in HTML. Control characters are not allowed in XML
+// 1.0, so OOXML spells them _xHHHH_.
+void appendXmlText(std::string& out, std::string_view text) {
+    static const char HEX[] = "0123456789ABCDEF";
+    size_t start = 0;
+    for (size_t i = 0; i < text.size(); ++i) {
+        unsigned char ch = static_cast<unsigned char>(text[i]);
+        if (ch >= 0x20 || ch == '\t' || ch == '\n' || ch == '\r') continue;
+        appendEscaped(out, text.substr(start, i - start));
+        out += "_x00";
+        out += HEX[ch >> 4];
+        out += HEX[ch & 0xF];
+        out += '_';
+        start = i + 1;
+    }
+    appendEscaped(out, text.substr(start));
+}
+
+std::string columnName(uint32_t column) {
+    std::string name;
+    for (uint32_t n = column + 1; n > 0; n = (n - 1) / 26) {
+        name.insert(name.begin(), static_cast<char>('A' + (n - 1) % 26));
+    }
+    return name;
+}
+
+}  // namespace
+
+XlsxWriter::XlsxWriter(std::ostream& os, const std::string& sheetName)
+    : zip(os) {
+    zip.beginEntry("[Content_Types].xml");
+    zip.write(
+        "<?xml version=\"1.0\" encoding=\"UTF-8\" standalone=\"yes\"?>\n"
+        "<Types xmlns=\"http://schemas.openxmlformats.org/package/2006/"
+        "content-types\">"
+        "<Default Extension=\"rels\" ContentType=\"application/"
+        "vnd.openxmlformats-package.relationships+xml\"/>"
+        "<Default Extension=\"xml\" ContentType=\"application/xml\"/>"
+        "<Override PartName=\"/xl/workbook.xml\" ContentType=\"application/"
+        "vnd.openxmlformats-officedocument.spreadsheetml.sheet.main+xml\"/>"
+        "<Override PartName=\"/xl/worksheets/sheet1.xml\" "
+        "ContentType=\"application/"
+        "vnd.openxmlformats-officedocument.spreadsheetml.worksheet+xml\"/>"
+        "</Types>");
+    zip.endEntry();
+
+    zip.beginEntry("_rels/.rels");
+    zip.write(
+        "<?xml version=\"1.0\" encoding=\"UTF-8\" standalone=\"yes\"?>\n"
+        "<Relationships xmlns=\"http://schemas.openxmlformats.org/package/2006/"
+        "relationships\">"
+        "<Relationship Id=\"rId1\" Type=\"http://schemas.openxmlformats.org/"
+        "officeDocument/2006/relationships/officeDocument\" "
+        "Target=\"xl/workbook.xml\"/>"
+        "</Relationships>");
+    zip.endEntry();
+
+    std::string workbook =
+        "<?xml version=\"1.0\" encoding=\"UTF-8\" standalone=\"yes\"?>\n"
+        "<workbook xmlns=\"http://schemas.openxmlformats.org/spreadsheetml/"
+        "2006/main\" xmlns:r=\"http://schemas.openxmlformats.org/"
+        "officeDocument/2006/relationships\"><sheets><sheet name=\"";
+    appendXmlText(workbook, sheetName);
+    workbook += "\" sheetId=\"1\" r:id=\"rId1\"/></sheets></workbook>";
+    zip.beginEntry("xl/workbook.xml");
+    zip.write(workbook);
+    zip.endEntry();
+
+    zip.beginEntry("xl/_rels/workbook.xml.rels");
+    zip.write(
+        "<?xml version=\"1.0\" encoding=\"UTF-8\" standalone=\"yes\"?>\n"
+        "<Relationships xmlns=\"http://schemas.openxmlformats.org/package/2006/"
+        "relationships\">"
+        "<Relationship Id=\"rId1\" Type=\"http://schemas.openxmlformats.org/"
+        "officeDocument/2006/relationships/worksheet\" "
+        "Target=\"worksheets/sheet1.xml\"/>"
+        "</Relationships>");
+    zip.endEntry();
+
+    // The sheet stays open; rows are deflated as the buffer fills up
+    zip.beginEntry("xl/worksheets/sheet1.xml");
+    buffer =
+        "<?xml version=\"1.0\" encoding=\"UTF-8\" standalone=\"yes\"?>\n"
+        "<worksheet xmlns=\"http://schemas.openxmlformats.org/spreadsheetml/"
+        "2006/main\"><sheetData>";
+}
+
+void XlsxWriter::flushIfFull() {
+    if (buffer.size() >= FLUSH_SIZE) {
+        zip.write(buffer);
+        buffer.clear();
+    }
+}
+
+void XlsxWriter::beginRow() {
+    row++;
+    column = 0;
+    buffer += "<row r=\"";
+    buffer += std::to_string(row);
+    buffer += "\">";
+}
+
+void XlsxWriter::writeReference() {
+    // addEmptyCell skips columns, so more than one name may be missing.
+    while (columnNames.size() <= column) {
+        columnNames.push_back(
+            columnName(static_cast<uint32_t>(columnNames.size())));
+    }
+    buffer += "<c r=\"";
+    buffer += columnNames[column];
+    buffer += std::to_string(row);
+    buffer += '"';
+    column++;
+}
+
+void XlsxWriter::addCell(std::string_view text) {
+    writeReference();
+    buffer += " t=\"inlineStr\"><is><t xml:space=\"preserve\">";
+    appendXmlText(buffer, text);
+    buffer += "</t></is></c>";
+}
+
+void XlsxWriter::addCell(double value) {
+    if (!std::isfinite(value)) {
+        addEmptyCell();
+        return;
+    }
+
+    writeReference();
+    char digits[32];
+    auto result = std::to_chars(digits, digits + sizeof(digits), value);
+    buffer += "><v>";
+    buffer.append(digits, result.ptr);
+    buffer += "</v></c>";
+}
+
+void XlsxWriter::addEmptyCell() {
+    column++;
+}
+
+void XlsxWriter::endRow() {
+    buffer += "</row>";
+    flushIfFull();
+}
+
+void XlsxWriter::finish() {
+    buffer += "</sheetData></worksheet>";
+    zip.write(buffer);
+    buffer.clear();
+    zip.endEntry();
+    zip.finish();
+}
+
+void exportScoreboardXlsx(const Scoreboard& scoreboard, std::ostream& os) {
+    auto ranking = scoreboard.getRanking();
+
+    std::set<std::string, decltype(&contestIdLess)> contestIds(contestIdLess);
+    for (const auto& [teamID, contestant] : ranking) {
+        for (const auto& [contestId, score] : contestant->getContestScores()) {
+            contestIds.insert(contestId);
+        }
+    }
+
+    const bool rated = Settings::getInstance().RATING_ENABLED;
+
+    XlsxWriter writer(os, "Scoreboard");
+    writer.beginRow();
+    for (const char* name :
+         {"Rank", "Team ID", "Total Contest Score", "Total Homework Score",
+          "Total Upsolved Score", "Bonus Score", "Overall Score"}) {
+        writer.addCell(name);
+    }
+    if (rated) writer.addCell("Rating");
+    for (const std::string& contestId : contestIds) writer.addCell(contestId);
+    writer.endRow();
+
+    int rank = 1;
+    for (const auto& [teamID, contestant] : ranking) {
+        writer.beginRow();
+        writer.addCell(static_cast<double>(rank++));
+        writer.addCell(teamID);
+        writer.addCell(contestant->getScoreContest());
+        writer.addCell(contestant->getScoreHomework());
+        writer.addCell(contestant->getScoreUpsolved());
+        writer.addCell(contestant->getScoreBonus());
+        writer.addCell(contestant->getTotalScore());
+        if (rated) writer.addCell(scoreboard.getRatings().getRating(teamID));
+
+        const auto& scores = contestant->getContestScores();
+        for (const std::string& contestId : contestIds) {
+            auto it = scores.find(contestId);
+            if (it == scores.end()) {
+                writer.addEmptyCell();
+            } else {
+                writer.addCell(
+                    toDouble(it->second.total() + it->second.upsolve));
+            }
+        }
+        writer.endRow();
+    }
+
+    writer.finish();
+}
+
+}  // namespace MaratonaScore
@@ -0,0 +1,106 @@
+//    Copyright 2025 MaratonaCIn
+//
+//    Licensed under the Apache License, Version 2.0 (the "License");
+//    you may not use this file except in compliance with the License.
+//    You may obtain a copy of the License at
+//
+//        http://www.apache.org/licenses/LICENSE-2.0
+//
+//    Unless required by applicable law or agreed to in writing, software
+//    distributed under the License is distributed on an "AS IS" BASIS,
+//    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//    See the License for the specific language governing permissions and
+//    limitations under the License.
+
+#include "parser/AsyncProcessor.hpp"
+
+#include <sstream>
+#include <utility>
+
+#include "parser/SeasonLoader.hpp"
+
+namespace MaratonaScore {
+
+ProcessHandle& ProcessHandle::operator=(ProcessHandle&& other) noexcept {
+    if (this != &other) {
+        stop();
+        cancelled = std::move(other.cancelled);
+        result = std::move(other.result);
+        worker = std::move(other.worker);
+    }
+    return *this;
+}
+
+ProcessHandle::~ProcessHandle() { stop(); }
+
+void ProcessHandle::stop() {
+    cancel();
+    if (worker.joinable()) worker.join();
+}
+
+void ProcessHandle::cancel() {
+    if (cancelled) cancelled->store(true, std::memory_order_relaxed);
+}
+
+bool ProcessHandle::valid() const { return result.valid(); }
+
+bool ProcessHandle::ready() const {
+    return result.valid() && result.wait_for(std::chrono::seconds(0)) ==
+                                 std::future_status::ready;
+}
+
+void ProcessHandle::wait() const { result.wait(); }
+
+ProcessResult ProcessHandle::get() {
+    ProcessResult value = result.get();
+    if (worker.joinable()) worker.join();
+    return value;
+}
+
+ProcessHandle processSeasonAsync(const std::string& dataPath,
+                                 ProcessOptions options) {
+    ProcessHandle handle;
+    handle.cancelled = std::make_shared<std::atomic<bool>>(false);
+
+    std::promise<ProcessResult> promise;
+    handle.result = promise.get_future();
+
+    handle.worker = std::thread(
+        [dataPath, options = std::move(options), promise = std::move(promise),
+         cancelled = handle.cancelled]() mutable {
+            auto checkCancelled = [&cancelled]() {
+                if (cancelled->load(std::memory_order_relaxed)) {
+                    throw ProcessCancelled();
+                }
+            };
+
+            try {
+                ProcessResult value;
+                SeasonLoader loader(dataPath);
+                checkCancelled();
+
+                loader.populate(
+                    value.scoreboard,
+                    [&](const SeasonFile& file, size_t done, size_t total) {
+                        if (options.progress) {
+                            options.progress({done, total, file.path});
+                        }
+                        checkCancelled();
+                    });
+                checkCancelled();
+
+                if (options.renderCSV) {
+                    std::ostringstream os;
+                    value.scoreboard.renderCSV(os);
+                    value.csv = os.str();
+                }
+                promise.set_value(std::move(value));
+            } catch (...) {
+                promise.set_exception(std::current_exception());
+            }
+        });
+
+    return handle;
+}
+
+}  // namespace MaratonaScore
@@ -16,39 +16,47 @@
 
 #include <algorithm>
 #include <fstream>
+#include <set>
 #include <sstream>
 #include <stdexcept>
+#include <tuple>
 #include <vector>
 
 #include "score/getScore.hpp"
+#include "utils/Aliases.hpp"
 
 namespace MaratonaScore {
 
 Contest FinalParser::parse(const std::string& file_path) {
-    Contest contest(CONTEST);
-    contest.setId("FINALS");
-
     std::ifstream f_in(file_path);
     if (!f_in.is_open()) {
         throw std::runtime_error("Could not open finals file: " + file_path);
     }
 
-    std::string teamID = "";
+    return parse(f_in);
+}
+
+Contest FinalParser::parse(std::istream& f_in) {
+    Contest contest(CONTEST);
+    contest.setId("FINALS");
 
     std::vector<std::tuple<int, int, std::string>> temp_performances;
 
-    while (f_in >> teamID) {
-        if (teamID[0] == '#') continue;
+    // One "<team> <solved> <penalty>" per line; '#' starts a comment line.
+    std::string line;
+    while (std::getline(f_in, line)) {
+        std::istringstream fields(line);
+        std::string teamID;
+        if (!(fields >> teamID) || teamID[0] == '#') continue;
+
         int problemsSolved = 0;
         int penalty = 0;
+        fields >> problemsSolved >> penalty;
 
-        f_in >> problemsSolved >> penalty;
-
-        temp_performances.emplace_back(problemsSolved, penalty, teamID);
+        temp_performances.emplace_back(problemsSolved, penalty,
+                                       Aliases::resolve(teamID));
     }
 
-    f_in.close();
-
     std::sort(temp_performances.begin(), temp_performances.end(),
               [](const auto& a, const auto& b) {
                   if (std::get<0>(a) != std::get<0>(b)) {
@@ -57,8 +65,11 @@ Contest FinalParser::parse(const std::string& file_path) {
                   return std::get<1>(a) < std::get<1>(b);
               });
 
+    std::set<std::string> seen;
     int rank = 1;
     for (const auto& [problemsSolved, penalty, teamID] : temp_performances) {
+        if (!seen.insert(teamID).second) continue;  // aliases: keep the best
+
         Performance performance(rank, penalty);
         performance.setProblemsUpsolved(0);
         performance.setBonusScore(getRankBonus(CONTEST, rank));
@@ -0,0 +1,91 @@
+//    Copyright 2025 MaratonaCIn
+//
+//    Licensed under the Apache License, Version 2.0 (the "License");
+//    you may not use this file except in compliance with the License.
+//    You may obtain a copy of the License at
+//
+//        http://www.apache.org/licenses/LICENSE-2.0
+//
+//    Unless required by applicable law or agreed to in writing, software
+//    distributed under the License is distributed on an "AS IS" BASIS,
+//    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//    See the License for the specific language governing permissions and
+//    limitations under the License.
+
+
+#include "parser/RejudgeParser.hpp"
+
+#include <algorithm>
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+#include <sstream>
+#include <stdexcept>
+
+#include "utils/Aliases.hpp"
+#include "utils/Blacklist.hpp"
+#include "utils/StringUtils.hpp"
+
+namespace MaratonaScore {
+
+std::vector<RejudgePatch> RejudgeParser::parse(const std::string& file_path) {
+    std::ifstream f_in(file_path);
+    if (!f_in.is_open()) {
+        throw std::runtime_error("Could not open rejudge file: " + file_path);
+    }
+
+    std::vector<RejudgePatch> patches;
+    std::string line;
+    int lineNumber = 0;
+
+    while (std::getline(f_in, line)) {
+        lineNumber++;
+        line = trim(line.substr(0, line.find('#')));
+        if (line.empty()) continue;
+
+        std::istringstream in(line);
+        RejudgePatch patch;
+        std::string verdict;
+        in >> patch.contestId >> std::quoted(patch.teamID) >>
+            patch.problemId >> verdict;
+
+        bool ok = !in.fail();
+        if (ok && verdict == "AC") {
+            std::string time;
+            ok = static_cast<bool>(in >> time >> patch.tries);
+            // h:mm is read as hours and minutes, not minutes and seconds
+            if (std::count(time.begin(), time.end(), ':') == 1) time += ":00";
+            patch.verdict = REJUDGE_ACCEPTED;
+            patch.time = timeStringToMinutes(time);
+        } else if (ok && verdict == "WA") {
+            ok = static_cast<bool>(in >> patch.tries);
+            patch.verdict = REJUDGE_REJECTED;
+        } else if (ok && verdict == "CLEAR") {
+            patch.verdict = REJUDGE_CLEAR;
+        } else {
+            ok = false;
+        }
+
+        std::string extra;
+        if (!ok || in >> extra) {
+            throw std::runtime_error("Malformed rejudge line " +
+                                     std::to_string(lineNumber) + " in " +
+                                     file_path + ": " + line);
+        }
+
+        // Same rule as the sheets: a blacklisted handle or identity is out.
+        std::string handle = patch.teamID;
+        patch.teamID = Aliases::resolve(handle);
+        if (Blacklist::isBlacklisted(handle) ||
+            Blacklist::isBlacklisted(patch.teamID)) {
+            std::cerr << "[WARNING] Rejudge line " << lineNumber
+                      << " is for blacklisted " << handle << "; ignored\n";
+            continue;
+        }
+        patches.push_back(patch);
+    }
+
+    return patches;
+}
+
+}  // namespace MaratonaScore
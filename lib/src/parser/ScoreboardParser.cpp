@@ -16,16 +16,26 @@
 
 #include <OpenXLSX.hpp>
 #include <algorithm>
+#include <cctype>
+#include <charconv>
+#include <filesystem>
 #include <iomanip>
 #include <iostream>
+#include <optional>
 #include <regex>
+#include <set>
 #include <sstream>
 #include <stdexcept>
 #include <string>
+#include <string_view>
+#include <thread>
+#include <unordered_set>
 #include <utility>
 #include <vector>
 
+#include "parser/XlsxReader.hpp"
 #include "score/getScore.hpp"
+#include "utils/Aliases.hpp"
 #include "utils/Blacklist.hpp"
 #include "utils/StringUtils.hpp"
 
@@ -101,112 +111,255 @@ int penaltyFromString(const std::string& penaltyStr) {
     }
 }
 
-Contest ScoreboardParser::parse(const std::string& file_path,
-                                CONTEST_TYPE contestType) {
-    int TIME_LIMIT;
+namespace {
 
-    if (contestType == CONTEST) {
-        TIME_LIMIT = Settings::getInstance().CONTEST_TIME_LIMIT;
-    } else if (contestType == HOMEWORK) {
-        TIME_LIMIT = Settings::getInstance().HOMEWORK_TIME_LIMIT;
-    } else {
-        throw std::invalid_argument("Invalid contest type");
-    }
+struct DecodedRow {
+    bool valid = false;
+    Performance performance;
+    std::string teamID;
+    std::string error;
+};
 
-    OpenXLSX::XLDocument doc;
-    doc.open(file_path);
-    auto wks = doc.workbook().worksheet(doc.workbook().worksheetNames().at(0));
+std::string_view trimView(std::string_view text) {
+    while (!text.empty() && std::isspace(static_cast<unsigned char>(text.front()))) {
+        text.remove_prefix(1);
+    }
+    while (!text.empty() && std::isspace(static_cast<unsigned char>(text.back()))) {
+        text.remove_suffix(1);
+    }
+    return text;
+}
 
-    uint32_t row_count = wks.rowCount();
-    uint32_t col_count = wks.columnCount();
+// Leading integer of text, like std::stoi (leading blanks, then digits).
+bool leadingInt(std::string_view text, int& value) {
+    while (!text.empty() && std::isspace(static_cast<unsigned char>(text.front()))) {
+        text.remove_prefix(1);
+    }
+    if (!text.empty() && text.front() == '+') text.remove_prefix(1);
+    auto result = std::from_chars(text.data(), text.data() + text.size(), value);
+    return result.ec == std::errc();
+}
 
-    Contest contest(contestType);
-    std::vector<std::pair<Performance, std::string>> temp_performances;
+// Same reading as timeStringToMinutes ([[[d:]h:]m:]s, seconds rounded),
+// without splitting the cell into strings.
+int clockMinutes(std::string_view text) {
+    if (!text.empty() && text.back() == ':') text.remove_suffix(1);
+    if (text.empty()) return 0;
+
+    int parts[4] = {0, 0, 0, 0};  // seconds, minutes, hours, days
+    for (int& part : parts) {
+        size_t colon = text.rfind(':');
+        std::string_view field =
+            colon == std::string_view::npos ? text : text.substr(colon + 1);
+        if (!leadingInt(field, part)) return 0;
+        if (colon == std::string_view::npos) break;
+        text = text.substr(0, colon);
+    }
+    return parts[3] * 24 * 60 + parts[2] * 60 + parts[1] +
+           (parts[0] > 30 ? 1 : 0);
+}
 
-    for (uint32_t r = 2; r <= row_count; ++r) {
-        try {
-            std::string team_raw = cell_to_string(wks.cell(r, 2).value());
+// Problem columns past the 26th are named like spreadsheet columns: AA, AB...
+std::string problemLabel(size_t index) {
+    std::string label;
+    for (size_t n = index + 1; n > 0; n = (n - 1) / 26) {
+        label.insert(label.begin(), static_cast<char>('A' + (n - 1) % 26));
+    }
+    return label;
+}
 
-            if (team_raw.empty()) continue;
+// Where the fields of an export live, read once from its header row. vJudge
+// writes "Rank | Team | Score | Penalty | <label>\n<AC> / <tries> ...";
+// other layouts are recognized by their header names, and sheets without a
+// usable header fall back to that fixed order.
+struct ColumnPlan {
+    size_t team = 1;
+    size_t solved = 2;
+    size_t penalty = 3;
+    std::vector<std::pair<size_t, std::string>> problems;  // column, label
+};
+
+ColumnPlan planColumns(const ScoreboardParser::RawRow& header) {
+    ColumnPlan plan;
+
+    std::vector<std::string_view> names;
+    std::optional<size_t> team, solved, penalty;
+    for (size_t c = 0; c < header.size(); ++c) {
+        std::string_view name = header[c];
+        name = trimView(name.substr(0, name.find('\n')));
+        names.push_back(name);
+
+        std::string key(name);
+        std::transform(key.begin(), key.end(), key.begin(), [](unsigned char ch) {
+            return static_cast<char>(std::tolower(ch));
+        });
+        if (!team && (key == "team" || key == "user" || key == "contestant")) {
+            team = c;
+        } else if (!solved && (key == "score" || key == "solved")) {
+            solved = c;
+        } else if (!penalty && key == "penalty") {
+            penalty = c;
+        }
+    }
 
-            std::string teamID =
-                team_raw.substr(team_raw.find('(') + 1,
-                                team_raw.find(')') - team_raw.find('(') - 1);
-            std::string team_name = team_raw.substr(0, team_raw.find('('));
+    if (team && solved && penalty) {
+        plan.team = *team;
+        plan.solved = *solved;
+        plan.penalty = *penalty;
+    }
 
-            int problems = stoi(cell_to_string(wks.cell(r, 3).value()));
+    size_t first = std::max({plan.team, plan.solved, plan.penalty}) + 1;
+    std::set<std::string, std::less<>> used;
+    for (size_t c = first; c < std::max(header.size(), first); ++c) {
+        size_t index = c - first;
+        std::string label(c < names.size() ? names[c] : std::string_view());
+        if (label.empty() || used.count(label)) label = problemLabel(index);
+        used.insert(label);
+        plan.problems.emplace_back(c, std::move(label));
+    }
+    return plan;
+}
 
-            std::string penalty_raw = cell_to_string(wks.cell(r, 4).value());
-            int penalty = penaltyFromString(penalty_raw);
-            int real_penalty = 0;
+// "h:mm:ss" (accepted), "h:mm:ss\n(-k)" (accepted after k wrong tries) or
+// "(-k)" (k wrong tries, never accepted). Accepted past the time limit
+// counts as upsolved.
+bool decodeProblem(std::string_view cell, int timeLimit,
+                   ProblemStatus& status) {
+    if (trimView(cell).empty()) return false;
+
+    size_t open = cell.find('(');
+    if (open != std::string_view::npos) {
+        size_t close = cell.find(')', open);
+        int tries = 0;
+        if (!leadingInt(cell.substr(open + 1, close - open - 1), tries)) {
+            throw std::invalid_argument("invalid tries in '" +
+                                        std::string(cell) + "'");
+        }
+        status.setStatus(ATTEMPTED);
+        status.setAttempts(std::abs(tries));
+        status.setTimeTaken(0);
+    }
 
-            Performance performance(0, penalty);
+    std::string_view time = trimView(cell.substr(0, open));
+    if (!time.empty()) {
+        int minutes = clockMinutes(time);
+        status.setStatus(minutes <= timeLimit ? SOLVED : UPSOLVED);
+        status.setTimeTaken(minutes);
+    }
+    return status.getStatus() != NOT_ATTEMPTED;
+}
 
-            for (uint32_t c = 5; c <= col_count; ++c) {
-                std::string cellValue = cell_to_string(wks.cell(r, c).value());
+// Cells of a row read as text; columns past its end are empty.
+class TextCells {
+   public:
+    explicit TextCells(const ScoreboardParser::RawRow& row) : row(row) {}
 
-                if (trim(cellValue).empty()) {
-                    continue;
-                }
+    std::string_view text(size_t c) const {
+        return c < row.size() ? std::string_view(row[c]) : std::string_view();
+    }
+    bool count(size_t c, int& number) const {
+        return leadingInt(text(c), number);
+    }
+    int penalty(size_t c) const {
+        return penaltyFromString(std::string(text(c)));
+    }
 
-                ProblemStatus status;
+   private:
+    const ScoreboardParser::RawRow& row;
+};
+
+// Reads only the columns in the plan.
+void decodeRow(const TextCells& cells, const ColumnPlan& plan, int timeLimit,
+               DecodedRow& out) {
+    // The handle in "Display Name(handle)", or the whole cell.
+    std::string_view team = cells.text(plan.team);
+    if (team.empty()) return;
+    size_t open = team.find('(');
+    size_t begin = open == std::string_view::npos ? 0 : open + 1;
+    size_t close = team.find(')', begin);
+    std::string teamID(team.substr(
+        begin, close == std::string_view::npos ? std::string_view::npos
+                                               : close - begin));
+
+    int problems = 0;
+    if (!cells.count(plan.solved, problems)) {
+        throw std::invalid_argument("invalid score '" +
+                                    std::string(cells.text(plan.solved)) + "'");
+    }
 
-                if (cellValue.find('(') != std::string::npos) {
-                    size_t pos_start = cellValue.find('(') + 1;
-                    size_t pos_end = cellValue.find(')');
-                    size_t count = pos_end - pos_start;
-                    std::string number_part =
-                        cellValue.substr(pos_start, count);
+    Performance performance(0, cells.penalty(plan.penalty));
+    int real_penalty = 0;
 
-                    status.setStatus(ATTEMPTED);
-                    status.setAttempts(std::abs(std::stoi(number_part)));
-                    status.setTimeTaken(0);
-                }
+    for (const auto& [column, label] : plan.problems) {
+        ProblemStatus status;
+        if (!decodeProblem(cells.text(column), timeLimit, status)) continue;
 
-                cellValue = cellValue.substr(0, cellValue.find('('));
+        if (status.getStatus() == SOLVED) {
+            real_penalty += status.getTimeTaken() + status.getAttempts() * 20;
+        }
+        performance.addProblem(label, status);
+    }
+    performance.setPenalty(real_penalty);
+    performance.setProblemsUpsolved(problems - performance.getProblemsSolved());
 
-                if (!cellValue.empty()) {
-                    int problemPenalty = timeStringToMinutes(cellValue);
+    out.performance = std::move(performance);
+    out.teamID = std::move(teamID);
+    out.valid = true;
+}
 
-                    if (problemPenalty <= TIME_LIMIT) {
-                        status.setStatus(SOLVED);
-                        real_penalty += problemPenalty;
-                        real_penalty += status.getAttempts() * 20;
-                    } else {
-                        status.setStatus(UPSOLVED);
-                    }
-                    status.setTimeTaken(problemPenalty);
-                }
+int timeLimitFor(CONTEST_TYPE contestType) {
+    if (contestType == CONTEST) {
+        return Settings::getInstance().CONTEST_TIME_LIMIT;
+    } else if (contestType == HOMEWORK) {
+        return Settings::getInstance().HOMEWORK_TIME_LIMIT;
+    }
+    throw std::invalid_argument("Invalid contest type");
+}
 
-                char problem_char = static_cast<char>((c - 5) + 'A');
-                std::string problem_id(1, problem_char);
+// Ranks the decoded rows (in sheet order) into a contest.
+Contest rankRows(std::vector<DecodedRow>& decoded,
+                 const ScoreboardParser::TeamFilter& keep,
+                 const std::string& contestId, CONTEST_TYPE contestType) {
+    Contest contest(contestType);
+    contest.setId(contestId);
 
-                performance.addProblem(problem_id, status);
-            }
-            performance.setPenalty(real_penalty);
-            performance.setProblemsUpsolved(problems -
-                                            performance.getProblemsSolved());
-            temp_performances.emplace_back(performance, teamID);
-
-        } catch (const std::exception& e) {
-            std::cerr << "[WARNING] Pulando linha " << r
-                      << ". Erro: " << e.what() << "\n";
+    std::vector<std::pair<Performance, std::string>> temp_performances;
+    temp_performances.reserve(decoded.size());
+
+    // Aliases are resolved here, on one thread; a handle that is itself
+    // blacklisted stays out even if its identity is not.
+    for (size_t i = 0; i < decoded.size(); ++i) {
+        if (decoded[i].valid) {
+            if (Blacklist::isBlacklisted(decoded[i].teamID)) continue;
+            std::string teamID = Aliases::resolve(decoded[i].teamID);
+            if (keep && !keep(teamID)) continue;
+            temp_performances.emplace_back(std::move(decoded[i].performance),
+                                           std::move(teamID));
+        } else if (!decoded[i].error.empty()) {
+            std::cerr << "[WARNING] Pulando linha " << i + 2
+                      << ". Erro: " << decoded[i].error << "\n";
         }
     }
 
-    doc.close();
-
     sort(temp_performances.begin(), temp_performances.end());
 
     std::vector<std::pair<Performance, std::string>> filtered_performances;
+    std::unordered_set<std::string> seen;
     int newRank = 1;
 
     for (auto& [performance, teamID] : temp_performances) {
+        // Two handles of one contestant in the same sheet: keep the best.
+        if (!seen.insert(teamID).second) {
+            std::cerr << "[WARNING] " << teamID
+                      << " appears more than once (aliases); keeping the "
+                         "best result\n";
+            continue;
+        }
         if (!Blacklist::isBlacklisted(teamID)) {
             performance.setRank(newRank);
 
             if (newRank <= Settings::getInstance().CONTEST_PERSON_BONUS) {
-                double bonus = getRankBonus(contestType, newRank);
+                ScoreValue bonus = getRankBonus(contestType, newRank);
                 performance.setBonusScore(bonus);
             }
 
@@ -221,4 +374,107 @@ Contest ScoreboardParser::parse(const std::string& file_path,
     return contest;
 }
 
+// Rows below this are decoded on the calling thread.
+constexpr size_t MIN_ROWS_PER_THREAD = 1024;
+
+}  // namespace
+
+Contest ScoreboardParser::parse(const std::string& file_path,
+                                CONTEST_TYPE contestType) {
+    OpenXLSX::XLDocument doc;
+    doc.open(file_path);
+    auto wks = doc.workbook().worksheet(doc.workbook().worksheetNames().at(0));
+
+    uint32_t row_count = wks.rowCount();
+    uint32_t col_count = wks.columnCount();
+
+    // OpenXLSX is not thread safe, so the cells are read here and decoded by
+    // parseRows. The header is read whole; data rows only up to the last
+    // column of the plan, and only the planned cells of that range.
+    std::vector<RawRow> rows(row_count);
+    if (row_count >= 1) {
+        rows[0].reserve(col_count);
+        for (uint32_t c = 1; c <= col_count; ++c) {
+            rows[0].push_back(cell_to_string(wks.cell(1, c).value()));
+        }
+    }
+    const ColumnPlan plan = planColumns(row_count >= 1 ? rows[0] : RawRow());
+
+    std::vector<size_t> planned = {plan.team, plan.solved, plan.penalty};
+    for (const auto& [column, label] : plan.problems) planned.push_back(column);
+    planned.erase(std::remove_if(planned.begin(), planned.end(),
+                                 [&](size_t c) { return c >= col_count; }),
+                  planned.end());
+    const size_t width =
+        planned.empty()
+            ? 0
+            : *std::max_element(planned.begin(), planned.end()) + 1;
+
+    for (uint32_t r = 2; r <= row_count; ++r) {
+        RawRow& row = rows[r - 1];
+        row.resize(width);
+        for (size_t c : planned) {
+            row[c] = cell_to_string(
+                wks.cell(r, static_cast<uint16_t>(c + 1)).value());
+        }
+    }
+
+    doc.close();
+
+    return parseRows(rows, std::filesystem::path(file_path).stem().string(),
+                     contestType);
+}
+
+ScoreboardParser::ScoreboardParser(TeamFilter keep) : keep(std::move(keep)) {}
+
+Contest ScoreboardParser::parseWorkbook(std::string_view workbook,
+                                        const std::string& contestId,
+                                        CONTEST_TYPE contestType) {
+    return parseRows(XlsxReader().readFirstSheet(workbook), contestId,
+                     contestType);
+}
+
+Contest ScoreboardParser::parseRows(const std::vector<RawRow>& rows,
+                                    const std::string& contestId,
+                                    CONTEST_TYPE contestType) {
+    const int timeLimit = timeLimitFor(contestType);
+
+    // Row 1 is the header; it decides which column holds what. Each worker
+    // decodes a contiguous range into its own slots, so the ranking sees
+    // rows in sheet order.
+    const ColumnPlan plan = planColumns(rows.empty() ? RawRow() : rows[0]);
+    const size_t count = rows.size() > 1 ? rows.size() - 1 : 0;
+    std::vector<DecodedRow> decoded(count);
+
+    auto decodeRange = [&](size_t begin, size_t end) {
+        for (size_t i = begin; i < end; ++i) {
+            try {
+                decodeRow(TextCells(rows[i + 1]), plan, timeLimit, decoded[i]);
+            } catch (const std::exception& e) {
+                decoded[i].valid = false;
+                decoded[i].error = e.what();
+            }
+        }
+    };
+
+    size_t threads = std::max(0, Settings::getInstance().PARSER_THREADS);
+    if (threads == 0) {
+        threads = std::max(1u, std::thread::hardware_concurrency());
+    }
+    threads = std::clamp<size_t>(count / MIN_ROWS_PER_THREAD, 1, threads);
+
+    if (threads == 1) {
+        decodeRange(0, count);
+    } else {
+        std::vector<std::thread> workers;
+        for (size_t t = 0; t < threads; ++t) {
+            workers.emplace_back(decodeRange, count * t / threads,
+                                 count * (t + 1) / threads);
+        }
+        for (auto& worker : workers) worker.join();
+    }
+
+    return rankRows(decoded, keep, contestId, contestType);
+}
+
 }  // namespace MaratonaScore
\ No newline at end of file
@@ -0,0 +1,52 @@
+//    Copyright 2025 MaratonaCIn
+//
+//    Licensed under the Apache License, Version 2.0 (the "License");
+//    you may not use this file except in compliance with the License.
+//    You may obtain a copy of the License at
+//
+//        http://www.apache.org/licenses/LICENSE-2.0
+//
+//    Unless required by applicable law or agreed to in writing, software
+//    distributed under the License is distributed on an "AS IS" BASIS,
+//    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//    See the License for the specific language governing permissions and
+//    limitations under the License.
+
+
+#include "parser/SeasonBundle.hpp"
+
+#include <filesystem>
+#include <iostream>
+#include <stdexcept>
+
+namespace MaratonaScore {
+
+SeasonBundle::SeasonBundle(const std::string& path)
+    : file(path), archive(file.view()) {
+    for (const Archive::Entry& entry : archive.getEntries()) {
+        std::string name = std::filesystem::path(entry.name).filename().string();
+        if (!byName.emplace(name, &entry).second) {
+            std::cerr << "[WARNING] Duplicate " << name << " in " << path
+                      << ", using the first one\n";
+        }
+    }
+}
+
+bool SeasonBundle::isBundle(const std::string& path) {
+    return std::filesystem::is_regular_file(path);
+}
+
+bool SeasonBundle::contains(const std::string& name) const {
+    return byName.count(name) > 0;
+}
+
+std::string_view SeasonBundle::read(const std::string& name,
+                                    std::string& buffer) const {
+    auto it = byName.find(name);
+    if (it == byName.end()) {
+        throw std::runtime_error("File not found in bundle: " + name);
+    }
+    return archive.read(*it->second, buffer);
+}
+
+}  // namespace MaratonaScore
@@ -0,0 +1,185 @@
+//    Copyright 2025 MaratonaCIn
+//
+//    Licensed under the Apache License, Version 2.0 (the "License");
+//    you may not use this file except in compliance with the License.
+//    You may obtain a copy of the License at
+//
+//        http://www.apache.org/licenses/LICENSE-2.0
+//
+//    Unless required by applicable law or agreed to in writing, software
+//    distributed under the License is distributed on an "AS IS" BASIS,
+//    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//    See the License for the specific language governing permissions and
+//    limitations under the License.
+
+#include "parser/SeasonLoader.hpp"
+
+#include <filesystem>
+#include <iostream>
+#include <sstream>
+
+#include "parser/FinalParser.hpp"
+#include "parser/ScoreboardParser.hpp"
+#include "utils/Settings.hpp"
+
+namespace MaratonaScore {
+
+SeasonLoader::SeasonLoader(const std::string& basePath) : basePath(basePath) {
+    if (SeasonBundle::isBundle(basePath)) {
+        bundle = std::make_shared<SeasonBundle>(basePath);
+    }
+}
+
+std::vector<SeasonFile> SeasonLoader::listFiles() const {
+    namespace fs = std::filesystem;
+
+    std::vector<SeasonFile> files;
+    const int contests = Settings::getInstance().NUMBER_OF_CONTESTS;
+
+    if (bundle) {
+        for (int i = 0; i < contests; i++) {
+            std::string contest = std::to_string(i + 1) + ".xlsx";
+            if (bundle->contains(contest)) {
+                files.push_back({contest, CONTEST, i, false});
+            }
+
+            std::string homework = "H" + std::to_string(i + 1) + ".xlsx";
+            if (bundle->contains(homework)) {
+                files.push_back({homework, HOMEWORK, i, false});
+            }
+        }
+
+        if (bundle->contains("finals.txt")) {
+            files.push_back({"finals.txt", CONTEST, contests, true});
+        }
+
+        return files;
+    }
+
+    for (int i = 0; i < contests; i++) {
+        fs::path contest = fs::path(basePath) / (std::to_string(i + 1) + ".xlsx");
+        if (fs::exists(contest)) {
+            files.push_back({contest.string(), CONTEST, i, false});
+        }
+
+        fs::path homework =
+            fs::path(basePath) / ("H" + std::to_string(i + 1) + ".xlsx");
+        if (fs::exists(homework)) {
+            files.push_back({homework.string(), HOMEWORK, i, false});
+        }
+    }
+
+    fs::path finals = fs::path(basePath) / "finals.txt";
+    if (fs::exists(finals)) {
+        files.push_back({finals.string(), CONTEST, contests, true});
+    }
+
+    return files;
+}
+
+Contest SeasonLoader::load(const SeasonFile& file) const {
+    return load(file, nullptr);
+}
+
+Contest SeasonLoader::load(const SeasonFile& file,
+                           const ScoreboardParser::TeamFilter& keep) const {
+    if (file.finals) {
+        Contest finals;
+        if (bundle) {
+            std::string buffer;
+            std::istringstream in{std::string(bundle->read(file.path, buffer))};
+            finals = FinalParser().parse(in);
+        } else {
+            finals = FinalParser().parse(file.path);
+        }
+        if (!keep) return finals;
+
+        Contest kept(finals.getType());
+        kept.setId(finals.getId());
+        for (const auto& [teamID, performance] : finals.getPerformances()) {
+            if (keep(teamID)) kept.addPerformance(teamID, performance);
+        }
+        return kept;
+    }
+
+    ScoreboardParser parser(keep);
+    if (bundle) {
+        std::string buffer;
+        std::string_view bytes = bundle->read(file.path, buffer);
+        return parser.parseWorkbook(
+            bytes, std::filesystem::path(file.path).stem().string(), file.type);
+    }
+    return parser.parse(file.path, file.type);
+}
+
+std::vector<Contest> SeasonLoader::loadAll() const {
+    std::vector<Contest> contests;
+
+    for (const SeasonFile& file : listFiles()) {
+        try {
+            contests.push_back(load(file));
+        } catch (const std::exception& e) {
+            std::cerr << "[WARNING] Could not load " << file.path << ": "
+                      << e.what() << '\n';
+        }
+    }
+
+    return contests;
+}
+
+namespace {
+
+template <typename Board>
+void populateBoard(const SeasonLoader& loader, Board& scoreboard,
+                   std::vector<std::pair<SeasonFile, Contest>>* loaded,
+                   const SeasonLoader::FileCallback* afterFile = nullptr) {
+    bool filtered = false;
+
+    const std::vector<SeasonFile> files = loader.listFiles();
+    for (size_t i = 0; i < files.size(); ++i) {
+        const SeasonFile& file = files[i];
+        if (file.finals && !filtered) {
+            scoreboard.applyContestFiltering();
+            filtered = true;
+        }
+
+        try {
+            if (loaded) {
+                loaded->emplace_back(file, loader.load(file));
+                scoreboard.addContest(loaded->back().second, file.index);
+            } else {
+                scoreboard.addContest(loader.load(file), file.index);
+            }
+        } catch (const std::exception& e) {
+            std::cerr << "[WARNING] Could not load " << file.path << ": "
+                      << e.what() << '\n';
+        }
+
+        if (afterFile) (*afterFile)(file, i + 1, files.size());
+    }
+
+    if (!filtered) scoreboard.applyContestFiltering();
+}
+
+}  // namespace
+
+void SeasonLoader::populate(Scoreboard& scoreboard) const {
+    populateBoard(*this, scoreboard, nullptr);
+}
+
+void SeasonLoader::populate(StreamingScoreboard& scoreboard) const {
+    populateBoard(*this, scoreboard, nullptr);
+}
+
+void SeasonLoader::populate(
+    Scoreboard& scoreboard,
+    std::vector<std::pair<SeasonFile, Contest>>& loaded) const {
+    populateBoard(*this, scoreboard, &loaded);
+}
+
+void SeasonLoader::populate(Scoreboard& scoreboard,
+                            const FileCallback& afterFile) const {
+    populateBoard(*this, scoreboard, nullptr, &afterFile);
+}
+
+}  // namespace MaratonaScore
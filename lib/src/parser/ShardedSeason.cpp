@@ -0,0 +1,293 @@
+//    Copyright 2025 MaratonaCIn
+//
+//    Licensed under the Apache License, Version 2.0 (the "License");
+//    you may not use this file except in compliance with the License.
+//    You may obtain a copy of the License at
+//
+//        http://www.apache.org/licenses/LICENSE-2.0
+//
+//    Unless required by applicable law or agreed to in writing, software
+//    distributed under the License is distributed on an "AS IS" BASIS,
+//    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//    See the License for the specific language governing permissions and
+//    limitations under the License.
+
+
+#include "parser/ShardedSeason.hpp"
+
+#include <algorithm>
+#include <filesystem>
+#include <iostream>
+#include <queue>
+#include <sstream>
+#include <stdexcept>
+#include <tuple>
+#include <unordered_map>
+
+#include "score/getScore.hpp"
+#include "utils/Settings.hpp"
+#include "utils/StringUtils.hpp"
+
+namespace MaratonaScore {
+
+namespace {
+
+std::string roundName(const SeasonFile& file) {
+    return std::filesystem::path(file.path).filename().string();
+}
+
+// Same order as ScoreboardParser: more solved, less penalty, then team ID.
+bool leaderBefore(const RoundLeader& a, const RoundLeader& b) {
+    return std::make_tuple(-a.solved, a.penalty, std::cref(a.teamID)) <
+           std::make_tuple(-b.solved, b.penalty, std::cref(b.teamID));
+}
+
+// The shard's part of a round, with rank bonuses from the global leaders.
+// Ranks past the bonus positions are not known to a shard and are left 0.
+Contest withGlobalRanks(const Contest& local, const RoundTally& global) {
+    std::unordered_map<std::string, int> ranks;
+    for (size_t i = 0; i < global.leaders.size(); i++) {
+        ranks[global.leaders[i].teamID] = static_cast<int>(i) + 1;
+    }
+
+    Contest contest(local.getType());
+    contest.setId(local.getId());
+    for (const auto& [teamID, performance] : local.getPerformances()) {
+        Performance ranked = performance;
+        auto it = ranks.find(teamID);
+        ranked.setRank(it == ranks.end() ? 0 : it->second);
+        ranked.setBonusScore(it == ranks.end()
+                                 ? 0
+                                 : getRankBonus(local.getType(), it->second));
+        contest.addPerformance(teamID, ranked);
+    }
+    return contest;
+}
+
+}  // namespace
+
+// FNV-1a, so every worker (and machine) agrees on the shard of a team.
+bool ShardSpec::owns(const std::string& teamID) const {
+    return count <= 1 ||
+           fnv1a(teamID) % static_cast<uint64_t>(count) ==
+               static_cast<uint64_t>(index);
+}
+
+void SeasonTally::save(std::ostream& os) const {
+    for (const RoundTally& round : rounds) {
+        os << "round\t" << round.round << '\t' << (round.finals ? 1 : 0) << '\t'
+           << round.problems.participants << '\n';
+        for (const auto& [problemId, count] : round.problems.solvers) {
+            os << "solvers\t" << problemId << '\t' << count << '\n';
+        }
+        for (const RoundLeader& leader : round.leaders) {
+            os << "leader\t" << leader.teamID << '\t' << leader.solved << '\t'
+               << leader.penalty << '\n';
+        }
+    }
+}
+
+SeasonTally SeasonTally::load(std::istream& is) {
+    SeasonTally tally;
+
+    std::string line;
+    int lineNumber = 0;
+    while (std::getline(is, line)) {
+        lineNumber++;
+        if (line.empty()) continue;
+
+        std::vector<std::string> fields;
+        std::istringstream split(line);
+        for (std::string field; std::getline(split, field, '\t');) {
+            fields.push_back(field);
+        }
+
+        try {
+            if (fields[0] == "round" && fields.size() == 4) {
+                RoundTally round;
+                round.round = fields[1];
+                round.finals = fields[2] == "1";
+                round.problems.participants = std::stoul(fields[3]);
+                tally.rounds.push_back(std::move(round));
+            } else if (tally.rounds.empty()) {
+                throw std::invalid_argument("entry before any round");
+            } else if (fields[0] == "solvers" && fields.size() == 3) {
+                tally.rounds.back().problems.solvers[fields[1]] =
+                    std::stoi(fields[2]);
+            } else if (fields[0] == "leader" && fields.size() == 4) {
+                tally.rounds.back().leaders.push_back(
+                    {fields[1], std::stoi(fields[2]), std::stoi(fields[3])});
+            } else {
+                throw std::invalid_argument("unknown entry");
+            }
+        } catch (const std::exception& e) {
+            throw std::runtime_error("Invalid shard tally at line " +
+                                     std::to_string(lineNumber) + ": " +
+                                     e.what());
+        }
+    }
+
+    return tally;
+}
+
+SeasonTally SeasonTally::merge(const std::vector<SeasonTally>& shards) {
+    SeasonTally merged;
+    std::unordered_map<std::string, size_t> position;
+
+    for (const SeasonTally& shard : shards) {
+        for (const RoundTally& round : shard.rounds) {
+            auto [it, inserted] =
+                position.try_emplace(round.round, merged.rounds.size());
+            if (inserted) {
+                merged.rounds.push_back({round.round, round.finals, {}, {}});
+            }
+
+            RoundTally& target = merged.rounds[it->second];
+            target.problems.merge(round.problems);
+            target.leaders.insert(target.leaders.end(), round.leaders.begin(),
+                                  round.leaders.end());
+        }
+    }
+
+    const size_t positions =
+        std::max(0, Settings::getInstance().CONTEST_PERSON_BONUS);
+    for (RoundTally& round : merged.rounds) {
+        std::sort(round.leaders.begin(), round.leaders.end(), leaderBefore);
+        if (round.leaders.size() > positions) round.leaders.resize(positions);
+    }
+
+    return merged;
+}
+
+ShardWorker::ShardWorker(const std::string& dataPath, ShardSpec shard)
+    : loader(dataPath), shard(shard) {
+    if (shard.count < 1 || shard.index < 0 || shard.index >= shard.count) {
+        throw std::invalid_argument("Invalid shard " +
+                                    std::to_string(shard.index) + " of " +
+                                    std::to_string(shard.count));
+    }
+}
+
+SeasonTally ShardWorker::tally() const {
+    const auto keep = [this](const std::string& teamID) {
+        return shard.owns(teamID);
+    };
+    const int positions = Settings::getInstance().CONTEST_PERSON_BONUS;
+
+    SeasonTally tally;
+    for (const SeasonFile& file : loader.listFiles()) {
+        Contest contest;
+        try {
+            contest = loader.load(file, keep);
+        } catch (const std::exception& e) {
+            std::cerr << "[WARNING] Could not load " << file.path << ": "
+                      << e.what() << '\n';
+            continue;
+        }
+
+        RoundTally round{roundName(file), file.finals,
+                         ContestTally::of(contest), {}};
+
+        // The finals are ranked over the whole file by every shard already.
+        if (!file.finals) {
+            for (const auto& [teamID, performance] : contest.getPerformances()) {
+                if (performance.getRank() >= 1 &&
+                    performance.getRank() <= positions) {
+                    round.leaders.push_back({teamID,
+                                             performance.getProblemsSolved(),
+                                             performance.getPenalty()});
+                }
+            }
+            std::sort(round.leaders.begin(), round.leaders.end(), leaderBefore);
+        }
+
+        tally.rounds.push_back(std::move(round));
+    }
+
+    return tally;
+}
+
+void ShardWorker::score(const SeasonTally& global,
+                        Scoreboard& scoreboard) const {
+    const auto keep = [this](const std::string& teamID) {
+        return shard.owns(teamID);
+    };
+
+    std::unordered_map<std::string, const RoundTally*> rounds;
+    for (const RoundTally& round : global.rounds) rounds[round.round] = &round;
+
+    bool filtered = false;
+    for (const SeasonFile& file : loader.listFiles()) {
+        if (file.finals && !filtered) {
+            scoreboard.applyContestFiltering();
+            filtered = true;
+        }
+
+        auto round = rounds.find(roundName(file));
+        if (round == rounds.end()) {
+            std::cerr << "[WARNING] " << file.path
+                      << " is not in the shard tally; skipped\n";
+            continue;
+        }
+
+        try {
+            Contest contest = loader.load(file, keep);
+            if (!file.finals) contest = withGlobalRanks(contest, *round->second);
+            scoreboard.addContest(contest, file.index, round->second->problems);
+        } catch (const std::exception& e) {
+            std::cerr << "[WARNING] Could not load " << file.path << ": "
+                      << e.what() << '\n';
+        }
+    }
+
+    if (!filtered) scoreboard.applyContestFiltering();
+}
+
+void mergeShardRuns(const std::vector<std::istream*>& runs,
+                    std::ostream& csv) {
+    struct Head {
+        ScoreValue total;
+        std::string teamID;
+        std::string row;
+        size_t run;
+    };
+
+    auto next = [&](size_t run, Head& head) {
+        std::string line;
+        if (!std::getline(*runs[run], line) || line.empty()) return false;
+
+        size_t first = line.find('\t');
+        size_t second =
+            first == std::string::npos ? first : line.find('\t', first + 1);
+        if (second == std::string::npos) {
+            throw std::runtime_error("Invalid line in shard run " +
+                                     std::to_string(run) + ": " + line);
+        }
+        head = {std::stoll(line.substr(0, first)),
+                line.substr(first + 1, second - first - 1),
+                line.substr(second + 1), run};
+        return true;
+    };
+
+    // Top of the queue is the next row of the ranking.
+    auto after = [](const Head& a, const Head& b) {
+        if (a.total != b.total) return a.total < b.total;
+        return a.teamID > b.teamID;
+    };
+    std::priority_queue<Head, std::vector<Head>, decltype(after)> heads(after);
+
+    for (size_t run = 0; run < runs.size(); run++) {
+        Head head;
+        if (next(run, head)) heads.push(std::move(head));
+    }
+
+    Scoreboard::renderCSVHeader(csv, false);
+    while (!heads.empty()) {
+        Head head = heads.top();
+        heads.pop();
+        csv << head.row << '\n';
+        if (next(head.run, head)) heads.push(std::move(head));
+    }
+}
+
+}  // namespace MaratonaScore
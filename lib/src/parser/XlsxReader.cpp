@@ -0,0 +1,306 @@
+//    Copyright 2025 MaratonaCIn
+//
+//    Licensed under the Apache License, Version 2.0 (the "License");
+//    you may not use this file except in compliance with the License.
+//    You may obtain a copy of the License at
+//
+//        http://www.apache.org/licenses/LICENSE-2.0
+//
+//    Unless required by applicable law or agreed to in writing, software
+//    distributed under the License is distributed on an "AS IS" BASIS,
+//    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//    See the License for the specific language governing permissions and
+//    limitations under the License.
+
+
+#include "parser/XlsxReader.hpp"
+
+#include <algorithm>
+#include <charconv>
+#include <cstdint>
+#include <stdexcept>
+
+#include "utils/Archive.hpp"
+
+namespace MaratonaScore {
+
+namespace {
+
+void appendUtf8(std::string& out, uint32_t code) {
+    if (code < 0x80) {
+        out += static_cast<char>(code);
+    } else if (code < 0x800) {
+        out += static_cast<char>(0xC0 | (code >> 6));
+        out += static_cast<char>(0x80 | (code & 0x3F));
+    } else if (code < 0x10000) {
+        out += static_cast<char>(0xE0 | (code >> 12));
+        out += static_cast<char>(0x80 | ((code >> 6) & 0x3F));
+        out += static_cast<char>(0x80 | (code & 0x3F));
+    } else {
+        out += static_cast<char>(0xF0 | (code >> 18));
+        out += static_cast<char>(0x80 | ((code >> 12) & 0x3F));
+        out += static_cast<char>(0x80 | ((code >> 6) & 0x3F));
+        out += static_cast<char>(0x80 | (code & 0x3F));
+    }
+}
+
+void appendDecoded(std::string& out, std::string_view text) {
+    for (size_t i = 0; i < text.size(); i++) {
+        size_t semicolon;
+        if (text[i] != '&' ||
+            (semicolon = text.find(';', i)) == std::string_view::npos) {
+            out += text[i];
+            continue;
+        }
+
+        std::string_view entity = text.substr(i + 1, semicolon - i - 1);
+        if (entity == "lt") {
+            out += '<';
+        } else if (entity == "gt") {
+            out += '>';
+        } else if (entity == "amp") {
+            out += '&';
+        } else if (entity == "quot") {
+            out += '"';
+        } else if (entity == "apos") {
+            out += '\'';
+        } else if (entity.size() > 1 && entity[0] == '#') {
+            bool hex = entity[1] == 'x' || entity[1] == 'X';
+            appendUtf8(out, std::stoul(std::string(entity.substr(hex ? 2 : 1)),
+                                       nullptr, hex ? 16 : 10));
+        } else {
+            out += text.substr(i, semicolon - i + 1);
+        }
+        i = semicolon;
+    }
+}
+
+// Value of attribute `name` inside the tag text, or empty.
+std::string_view attribute(std::string_view tag, std::string_view name) {
+    size_t pos = 0;
+    while ((pos = tag.find(name, pos)) != std::string_view::npos) {
+        size_t quote = pos + name.size() + 1;
+        bool boundary = pos > 0 && (tag[pos - 1] == ' ' || tag[pos - 1] == '\t' ||
+                                    tag[pos - 1] == '\n' || tag[pos - 1] == '\r');
+        if (boundary && quote < tag.size() && tag[quote - 1] == '=' &&
+            (tag[quote] == '"' || tag[quote] == '\'')) {
+            size_t close = tag.find(tag[quote], quote + 1);
+            if (close == std::string_view::npos) return {};
+            return tag.substr(quote + 1, close - quote - 1);
+        }
+        pos += name.size();
+    }
+    return {};
+}
+
+// Concatenated, decoded text of every <t> element in `xml`.
+std::string textRuns(std::string_view xml) {
+    std::string text;
+    size_t pos = 0;
+    while ((pos = xml.find("<t", pos)) != std::string_view::npos) {
+        char next = pos + 2 < xml.size() ? xml[pos + 2] : '\0';
+        size_t open = xml.find('>', pos);
+        if (open == std::string_view::npos) break;
+        if ((next != '>' && next != ' ') || xml[open - 1] == '/') {
+            pos = open;
+            continue;
+        }
+        size_t close = xml.find("</t>", open);
+        if (close == std::string_view::npos) break;
+        appendDecoded(text, xml.substr(open + 1, close - open - 1));
+        pos = close + 4;
+    }
+    return text;
+}
+
+// OOXML worksheet limits; references past them are malformed.
+constexpr size_t MAX_ROWS = 1048576;
+constexpr size_t MAX_COLUMNS = 16384;
+
+// Padded cells a sheet may span beyond one per byte of its XML, so a few
+// far-off references cannot blow up the rectangle.
+constexpr size_t MIN_CELL_BUDGET = 1 << 20;
+
+// One-based row of a <row r="12">, or 0 if it is not a valid row number.
+size_t rowOf(std::string_view reference) {
+    size_t row = 0;
+    auto result = std::from_chars(reference.data(),
+                                  reference.data() + reference.size(), row);
+    if (result.ec != std::errc() ||
+        result.ptr != reference.data() + reference.size() || row > MAX_ROWS) {
+        return 0;
+    }
+    return row;
+}
+
+// Zero-based column of a cell reference such as "AB12", or MAX_COLUMNS if
+// it does not start with a valid column.
+size_t columnOf(std::string_view reference) {
+    size_t column = 0;
+    for (char ch : reference) {
+        if (ch < 'A' || ch > 'Z') break;
+        column = column * 26 + (ch - 'A' + 1);
+        if (column > MAX_COLUMNS) return MAX_COLUMNS;
+    }
+    return column == 0 ? MAX_COLUMNS : column - 1;
+}
+
+std::string_view entryText(const Archive& archive, const std::string& name,
+                           std::string& buffer) {
+    const Archive::Entry* entry = archive.find(name);
+    if (!entry) return {};
+    return archive.read(*entry, buffer);
+}
+
+std::string firstSheetPath(const Archive& archive) {
+    std::string workbookBuffer, relsBuffer;
+    std::string_view workbook =
+        entryText(archive, "xl/workbook.xml", workbookBuffer);
+    std::string_view rels =
+        entryText(archive, "xl/_rels/workbook.xml.rels", relsBuffer);
+
+    size_t sheet = workbook.find("<sheet ");
+    if (sheet != std::string_view::npos) {
+        std::string_view tag =
+            workbook.substr(sheet, workbook.find('>', sheet) - sheet);
+        std::string_view id = attribute(tag, "r:id");
+
+        size_t pos = 0;
+        while (!id.empty() &&
+               (pos = rels.find("<Relationship ", pos)) != std::string_view::npos) {
+            std::string_view rel = rels.substr(pos, rels.find('>', pos) - pos);
+            if (attribute(rel, "Id") == id) {
+                std::string target(attribute(rel, "Target"));
+                if (!target.empty() && target[0] == '/') return target.substr(1);
+                return "xl/" + target;
+            }
+            pos += 14;
+        }
+    }
+
+    return "xl/worksheets/sheet1.xml";
+}
+
+}  // namespace
+
+std::vector<std::vector<std::string>> XlsxReader::readFirstSheet(
+    std::string_view workbook) {
+    Archive archive(workbook);
+
+    std::vector<std::string> sharedStrings;
+    std::string buffer;
+    std::string_view shared =
+        entryText(archive, "xl/sharedStrings.xml", buffer);
+    for (size_t pos = 0;
+         (pos = shared.find("<si>", pos)) != std::string_view::npos;) {
+        size_t close = shared.find("</si>", pos);
+        if (close == std::string_view::npos) break;
+        sharedStrings.push_back(textRuns(shared.substr(pos, close - pos)));
+        pos = close;
+    }
+
+    std::string sheetBuffer;
+    const std::string path = firstSheetPath(archive);
+    std::string_view sheet = entryText(archive, path, sheetBuffer);
+    if (sheet.data() == nullptr) {
+        throw std::runtime_error("Worksheet not found in workbook: " + path);
+    }
+
+    auto malformed = [&](const std::string& what) {
+        return std::runtime_error("Malformed worksheet " + path + ": " + what);
+    };
+    const size_t cellBudget = std::max(sheet.size(), MIN_CELL_BUDGET);
+    size_t cells = 0;
+
+    std::vector<std::vector<std::string>> rows;
+    size_t pos = sheet.find("<sheetData");
+    while (pos != std::string_view::npos &&
+           (pos = sheet.find('<', pos + 1)) != std::string_view::npos) {
+        size_t tagEnd = sheet.find('>', pos);
+        if (tagEnd == std::string_view::npos) break;
+        std::string_view tag = sheet.substr(pos, tagEnd - pos);
+
+        if (tag.substr(0, 4) == "<row" && (tag.size() == 4 || tag[4] == ' ')) {
+            std::string_view r = attribute(tag, "r");
+            size_t index = r.empty() ? rows.size() + 1 : rowOf(r);
+            if (index == 0 || index > MAX_ROWS) {
+                throw malformed("invalid row reference '" + std::string(r) +
+                                "'");
+            }
+            if (rows.size() < index) rows.resize(index);
+        } else if (tag.substr(0, 2) == "<c" &&
+                   (tag.size() == 2 || tag[2] == ' ')) {
+            if (rows.empty()) rows.resize(1);
+            std::vector<std::string>& row = rows.back();
+
+            std::string_view r = attribute(tag, "r");
+            size_t column = r.empty() ? row.size() : columnOf(r);
+            if (column >= MAX_COLUMNS) {
+                throw malformed("invalid cell reference '" + std::string(r) +
+                                "'");
+            }
+            if (row.size() <= column) {
+                cells += column + 1 - row.size();
+                if (cells > cellBudget) {
+                    throw malformed("rows span more than " +
+                                    std::to_string(cellBudget) + " cells");
+                }
+                row.resize(column + 1);
+            }
+
+            if (tag.back() == '/') {
+                pos = tagEnd;
+                continue;
+            }
+
+            size_t close = sheet.find("</c>", tagEnd);
+            if (close == std::string_view::npos) break;
+            std::string_view body = sheet.substr(tagEnd + 1, close - tagEnd - 1);
+            std::string_view type = attribute(tag, "t");
+
+            std::string value;
+            if (type == "inlineStr") {
+                value = textRuns(body);
+            } else {
+                size_t v = body.find("<v");
+                size_t open = v == std::string_view::npos ? v : body.find('>', v);
+                size_t end = body.find("</v>");
+                if (open != std::string_view::npos && end != std::string_view::npos &&
+                    body[open - 1] != '/') {
+                    appendDecoded(value, body.substr(open + 1, end - open - 1));
+                }
+                if (type == "s" && !value.empty()) {
+                    size_t index = sharedStrings.size();
+                    std::from_chars(value.data(), value.data() + value.size(),
+                                    index);
+                    if (index >= sharedStrings.size()) {
+                        throw malformed("invalid shared string '" + value +
+                                        "'");
+                    }
+                    value = sharedStrings[index];
+                } else if (type == "b") {
+                    value = value == "1" ? "true" : "false";
+                }
+            }
+
+            row[column] = std::move(value);
+            pos = close;
+        } else if (tag.substr(0, 11) == "</sheetData") {
+            break;
+        }
+    }
+
+    // Pad to a rectangle, as a worksheet reader would report it
+    size_t columns = 0;
+    for (const auto& row : rows) columns = std::max(columns, row.size());
+    if (columns != 0 && rows.size() > cellBudget / columns) {
+        throw malformed(std::to_string(rows.size()) + " rows by " +
+                        std::to_string(columns) + " columns is more than " +
+                        std::to_string(cellBudget) + " cells");
+    }
+    for (auto& row : rows) row.resize(columns);
+
+    return rows;
+}
+
+}  // namespace MaratonaScore
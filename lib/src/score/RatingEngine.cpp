@@ -0,0 +1,177 @@
+//    Copyright 2025 MaratonaCIn
+//
+//    Licensed under the Apache License, Version 2.0 (the "License");
+//    you may not use this file except in compliance with the License.
+//    You may obtain a copy of the License at
+//
+//        http://www.apache.org/licenses/LICENSE-2.0
+//
+//    Unless required by applicable law or agreed to in writing, software
+//    distributed under the License is distributed on an "AS IS" BASIS,
+//    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//    See the License for the specific language governing permissions and
+//    limitations under the License.
+
+
+#include "score/RatingEngine.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <fstream>
+#include <iomanip>
+#include <stdexcept>
+#include <vector>
+
+#include "utils/Settings.hpp"
+
+namespace MaratonaScore {
+
+namespace {
+
+// Ratings this far outside the field still get a distinct performance.
+constexpr int PERFORMANCE_MARGIN = 800 / RatingEngine::RATING_BIN;
+
+}  // namespace
+
+void RatingEngine::update(const Contest& contest) {
+    if (contest.getType() != CONTEST || contest.getPerformances().size() < 2) {
+        return;
+    }
+
+    const double initial = Settings::getInstance().RATING_INITIAL;
+    const double bin = RATING_BIN;
+
+    std::vector<Rating*> entries;
+    std::vector<double> actual;
+    for (const auto& [teamID, performance] : contest.getPerformances()) {
+        auto it = ratings.try_emplace(teamID, Rating{initial, 0}).first;
+        entries.push_back(&it->second);
+        actual.push_back(std::max(1, performance.getRank()));
+    }
+
+    const size_t n = entries.size();
+    double minRating = entries[0]->rating;
+    for (const Rating* entry : entries) {
+        minRating = std::min(minRating, entry->rating);
+    }
+
+    // Grid point g stands for rating base + g * RATING_BIN.
+    const double base = std::floor(minRating / bin) * bin -
+                        PERFORMANCE_MARGIN * bin;
+    std::vector<int> binOf(n);
+    std::map<int, int> counts;
+    int maxBin = 0;
+    for (size_t i = 0; i < n; i++) {
+        binOf[i] =
+            static_cast<int>(std::lround((entries[i]->rating - base) / bin));
+        counts[binOf[i]]++;
+        maxBin = std::max(maxBin, binOf[i]);
+    }
+    const int grid = maxBin + PERFORMANCE_MARGIN + 1;
+
+    // beats[grid - 1 + d]: probability that a bucket d steps below wins.
+    std::vector<double> beats(2 * grid - 1);
+    for (int d = -(grid - 1); d < grid; d++) {
+        beats[grid - 1 + d] = 1.0 / (1.0 + std::pow(10.0, d * bin / 400.0));
+    }
+    auto beat = [&](int g, int b) { return beats[grid - 1 + g - b]; };
+
+    // seed[g]: expected rank of rating g against the whole field, including
+    // a phantom copy of itself that is removed per contestant below.
+    std::vector<double> seed(grid, 1.0);
+    for (int g = 0; g < grid; g++) {
+        for (const auto& [b, count] : counts) seed[g] += count * beat(g, b);
+    }
+
+    std::vector<double> deltas(n);
+    double sum = 0.0;
+    for (size_t i = 0; i < n; i++) {
+        const int own = binOf[i];
+        auto against = [&](int g) { return seed[g] - beat(g, own); };
+
+        const double expected = against(own);
+        const double target = std::sqrt(expected * actual[i]);
+
+        // against() decreases with g: find the first grid point below target
+        int lo = 0, hi = grid - 1;
+        while (lo < hi) {
+            int mid = (lo + hi) / 2;
+            if (against(mid) < target) {
+                hi = mid;
+            } else {
+                lo = mid + 1;
+            }
+        }
+
+        double performance = base + lo * bin;
+        if (lo > 0 && against(lo) < target) {
+            double above = against(lo - 1), below = against(lo);
+            performance -= bin * (target - below) / (above - below);
+        }
+
+        deltas[i] = (performance - entries[i]->rating) / 2.0;
+        sum += deltas[i];
+    }
+
+    const double correction = sum / n;
+    for (size_t i = 0; i < n; i++) {
+        entries[i]->rating += deltas[i] - correction;
+        entries[i]->contests++;
+    }
+}
+
+bool RatingEngine::hasRating(const std::string& teamID) const {
+    return ratings.count(teamID) > 0;
+}
+
+double RatingEngine::getRating(const std::string& teamID) const {
+    auto it = ratings.find(teamID);
+    if (it == ratings.end()) return Settings::getInstance().RATING_INITIAL;
+    return it->second.rating;
+}
+
+const std::map<std::string, RatingEngine::Rating>& RatingEngine::getRatings()
+    const {
+    return ratings;
+}
+
+void RatingEngine::save(const std::string& path) const {
+    std::ofstream out(path);
+    if (!out.is_open()) {
+        throw std::runtime_error("Could not open ratings file: " + path);
+    }
+
+    out << "Team ID,Rating,Contests\n" << std::setprecision(17);
+    for (const auto& [teamID, entry] : ratings) {
+        out << teamID << "," << entry.rating << "," << entry.contests << "\n";
+    }
+}
+
+void RatingEngine::load(const std::string& path) {
+    std::ifstream in(path);
+    if (!in.is_open()) {
+        throw std::runtime_error("Could not open ratings file: " + path);
+    }
+
+    std::string line;
+    std::getline(in, line);  // header
+    while (std::getline(in, line)) {
+        if (!line.empty() && line.back() == '\r') line.pop_back();
+        if (line.empty()) continue;
+
+        // Team IDs may contain commas, the two numeric fields may not
+        size_t second = line.rfind(',');
+        size_t first = second == std::string::npos || second == 0
+                           ? std::string::npos
+                           : line.rfind(',', second - 1);
+        if (first == std::string::npos) {
+            throw std::runtime_error("Malformed ratings line: " + line);
+        }
+
+        ratings[line.substr(0, first)] = {
+            std::stod(line.substr(first + 1, second - first - 1)),
+            std::stoi(line.substr(second + 1))};
+    }
+}
+
+}  // namespace MaratonaScore
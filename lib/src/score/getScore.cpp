@@ -14,55 +14,28 @@
 
 #include "score/getScore.hpp"
 
-#include <cmath>
-
+#include "score/ScoringPolicy.hpp"
 #include "utils/Settings.hpp"
 
 namespace MaratonaScore {
 
-double getSolveScore(CONTEST_TYPE contestType, const Performance& performance,
-                     int contestIndex) {
-    double problem_value = 0.0;
-    if (contestType == CONTEST) {
-        problem_value = Settings::getInstance().CONTEST_BASE_VALUE *
-                        pow(2, double(contestIndex) /
-                                   Settings::getInstance().NUMBER_OF_CONTESTS);
-    } else if (contestType == HOMEWORK) {
-        problem_value = Settings::getInstance().HOMEWORK_BASE_VALUE *
-                        pow(2, double(contestIndex) /
-                                   Settings::getInstance().NUMBER_OF_CONTESTS);
-    }
-
-    return performance.getProblemsSolved() * problem_value;
+ScoreValue getSolveScore(CONTEST_TYPE contestType,
+                         const Performance& performance, int contestIndex) {
+    return withScoringPolicy([&](auto policy) {
+        return performance.getProblemsSolved() *
+               decltype(policy)::problemValue(contestType, contestIndex);
+    });
 }
 
-double getUpsolveScore(const Performance& performance) {
+ScoreValue getUpsolveScore(const Performance& performance) {
     return performance.getProblemsUpsolved() *
-           Settings::getInstance().UPSOLING_BASE_VALUE;
+           toFixed(Settings::getInstance().UPSOLING_BASE_VALUE);
 }
 
-double getRankBonus(CONTEST_TYPE contestType, int rank) {
-    if (rank < 1 || rank > Settings::getInstance().CONTEST_PERSON_BONUS) {
-        return 0.0;
-    }
-
-    double baseBonus;
-    int personBonus;
-
-    if (contestType == CONTEST) {
-        baseBonus = Settings::getInstance().CONTEST_SCORE_BONUS;
-        personBonus = Settings::getInstance().CONTEST_PERSON_BONUS;
-    } else if (contestType == HOMEWORK) {
-        baseBonus = Settings::getInstance().HOMEWORK_SCORE_BONUS;
-        personBonus = Settings::getInstance().HOMEWORK_PERSON_BONUS;
-    } else {
-        return 0.0;
-    }
-
-    double bonus = baseBonus * std::max(0.0, (double)(personBonus - rank + 1) /
-                                                 personBonus);
-
-    return bonus;
+ScoreValue getRankBonus(CONTEST_TYPE contestType, int rank) {
+    return withScoringPolicy([&](auto policy) {
+        return decltype(policy)::rankBonus(contestType, rank);
+    });
 }
 
-}  // namespace MaratonaScore
\ No newline at end of file
+}  // namespace MaratonaScore
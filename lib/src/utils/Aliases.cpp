@@ -0,0 +1,225 @@
+//    Copyright 2025 MaratonaCIn
+//
+//    Licensed under the Apache License, Version 2.0 (the "License");
+//    you may not use this file except in compliance with the License.
+//    You may obtain a copy of the License at
+//
+//        http://www.apache.org/licenses/LICENSE-2.0
+//
+//    Unless required by applicable law or agreed to in writing, software
+//    distributed under the License is distributed on an "AS IS" BASIS,
+//    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//    See the License for the specific language governing permissions and
+//    limitations under the License.
+
+#include "utils/Aliases.hpp"
+
+#include <fstream>
+#include <iostream>
+#include <mutex>
+#include <unordered_map>
+#include <vector>
+
+#include "utils/Settings.hpp"
+#include "utils/StringUtils.hpp"
+
+namespace MaratonaScore {
+
+namespace {
+
+// ASCII spelling of U+00C0..U+00FF, lowercase; empty keeps the character.
+constexpr const char* LATIN1_FOLD[64] = {
+    "a", "a", "a", "a", "a", "a", "ae", "c",  // À..Ç
+    "e", "e", "e", "e", "i", "i", "i",  "i",  // È..Ï
+    "d", "n", "o", "o", "o", "o", "o",  "",   // Ð..×
+    "o", "u", "u", "u", "u", "y", "th", "ss", // Ø..ß
+    "a", "a", "a", "a", "a", "a", "ae", "c",  // à..ç
+    "e", "e", "e", "e", "i", "i", "i",  "i",  // è..ï
+    "d", "n", "o", "o", "o", "o", "o",  "",   // ð..÷
+    "o", "u", "u", "u", "u", "y", "th", "y",  // ø..ÿ
+};
+
+struct AliasIndex {
+    std::mutex mutex;
+
+    std::unordered_map<std::string, int> ids;
+    std::vector<std::string> names;  // by interned id
+    std::vector<int> parent;
+    std::vector<int> canonical;  // by root: id of the name to report
+    std::vector<bool> pinned;    // by root: canonical set by the alias file
+
+    std::unordered_map<std::string, int> normalized;  // key -> first id
+
+    int find(int id) {
+        while (parent[id] != id) {
+            parent[id] = parent[parent[id]];
+            id = parent[id];
+        }
+        return id;
+    }
+
+    int intern(const std::string& name, bool& added) {
+        auto [it, inserted] = ids.emplace(name, static_cast<int>(names.size()));
+        added = inserted;
+        if (inserted) {
+            names.push_back(name);
+            parent.push_back(it->second);
+            canonical.push_back(it->second);
+            pinned.push_back(false);
+        }
+        return it->second;
+    }
+
+    // Merges the identities of a and b. The root keeps a pinned canonical
+    // name if either side has one (a's first), else a's.
+    void unite(int a, int b) {
+        a = find(a);
+        b = find(b);
+        if (a == b) return;
+        int name = pinned[a] || !pinned[b] ? canonical[a] : canonical[b];
+        bool pin = pinned[a] || pinned[b];
+        parent[b] = a;
+        canonical[a] = name;
+        pinned[a] = pin;
+    }
+
+    void clear() {
+        ids.clear();
+        names.clear();
+        parent.clear();
+        canonical.clear();
+        pinned.clear();
+        normalized.clear();
+    }
+};
+
+AliasIndex& aliasIndex() {
+    static AliasIndex index;
+    return index;
+}
+
+void addAliasLocked(AliasIndex& index, const std::string& canonicalName,
+                    const std::string& alias) {
+    bool added = false;
+    int root = index.find(index.intern(canonicalName, added));
+    if (!index.pinned[root]) {
+        index.canonical[root] = index.ids.at(canonicalName);
+        index.pinned[root] = true;
+    }
+    index.unite(root, index.intern(alias, added));
+
+    for (const std::string* name : {&canonicalName, &alias}) {
+        index.normalized.emplace(Aliases::normalize(*name),
+                                 index.ids.at(*name));
+    }
+}
+
+}  // namespace
+
+void Aliases::loadFromFile(const std::string& filepath) {
+    clear();
+
+    std::ifstream file(filepath);
+    if (!file.is_open()) return;  // aliases are optional
+
+    AliasIndex& index = aliasIndex();
+    std::lock_guard<std::mutex> lock(index.mutex);
+
+    int identities = 0;
+    std::string line;
+    while (std::getline(file, line)) {
+        line = trim(line);
+        if (line.empty() || line[0] == '#') continue;
+
+        std::vector<std::string> names;
+        size_t start = 0;
+        while (start <= line.size()) {
+            size_t end = line.find('|', start);
+            if (end == std::string::npos) end = line.size();
+            std::string name = trim(line.substr(start, end - start));
+            if (!name.empty()) names.push_back(std::move(name));
+            start = end + 1;
+        }
+        if (names.empty()) continue;
+
+        for (const std::string& name : names) {
+            addAliasLocked(index, names.front(), name);
+        }
+        identities++;
+    }
+
+    std::cout << "[INFO] Loaded " << identities << " alias identit"
+              << (identities == 1 ? "y" : "ies") << "\n";
+}
+
+void Aliases::addAlias(const std::string& canonical,
+                       const std::string& alias) {
+    AliasIndex& index = aliasIndex();
+    std::lock_guard<std::mutex> lock(index.mutex);
+    addAliasLocked(index, canonical, alias);
+}
+
+std::string Aliases::resolve(const std::string& teamID) {
+    const bool normalizeNames = Settings::getInstance().ALIAS_NORMALIZE_NAMES;
+
+    AliasIndex& index = aliasIndex();
+    std::lock_guard<std::mutex> lock(index.mutex);
+
+    if (!normalizeNames) {
+        auto it = index.ids.find(teamID);
+        if (it == index.ids.end()) return teamID;
+        return index.names[index.canonical[index.find(it->second)]];
+    }
+
+    bool added = false;
+    int id = index.intern(teamID, added);
+    if (added) {
+        auto [it, inserted] = index.normalized.emplace(normalize(teamID), id);
+        if (!inserted) index.unite(it->second, id);
+    }
+    return index.names[index.canonical[index.find(id)]];
+}
+
+void Aliases::clear() {
+    AliasIndex& index = aliasIndex();
+    std::lock_guard<std::mutex> lock(index.mutex);
+    index.clear();
+}
+
+std::string Aliases::normalize(const std::string& name) {
+    std::string key;
+    key.reserve(name.size());
+    bool space = false;
+
+    for (size_t i = 0; i < name.size(); ++i) {
+        unsigned char ch = static_cast<unsigned char>(name[i]);
+        if (ch == ' ' || ch == '\t' || ch == '_') {
+            space = !key.empty();
+            continue;
+        }
+        if (space) {
+            key += ' ';
+            space = false;
+        }
+
+        if (ch < 0x80) {
+            key += static_cast<char>(ch >= 'A' && ch <= 'Z' ? ch + 32 : ch);
+        } else if ((ch == 0xC3) && i + 1 < name.size() &&
+                   (static_cast<unsigned char>(name[i + 1]) & 0xC0) == 0x80) {
+            // U+00C0..U+00FF is 0xC3 0x80..0xBF in UTF-8
+            unsigned char next = static_cast<unsigned char>(name[++i]);
+            const char* folded = LATIN1_FOLD[next - 0x80];
+            if (*folded) {
+                key += folded;
+            } else {
+                key += static_cast<char>(ch);
+                key += static_cast<char>(next);
+            }
+        } else {
+            key += static_cast<char>(ch);
+        }
+    }
+    return key;
+}
+
+}  // namespace MaratonaScore
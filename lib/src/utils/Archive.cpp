@@ -0,0 +1,218 @@
+//    Copyright 2025 MaratonaCIn
+//
+//    Licensed under the Apache License, Version 2.0 (the "License");
+//    you may not use this file except in compliance with the License.
+//    You may obtain a copy of the License at
+//
+//        http://www.apache.org/licenses/LICENSE-2.0
+//
+//    Unless required by applicable law or agreed to in writing, software
+//    distributed under the License is distributed on an "AS IS" BASIS,
+//    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//    See the License for the specific language governing permissions and
+//    limitations under the License.
+
+
+#include "utils/Archive.hpp"
+
+#include <zlib.h>
+
+#include <algorithm>
+#include <stdexcept>
+
+namespace MaratonaScore {
+
+namespace {
+
+constexpr uint32_t ZIP_LOCAL_HEADER = 0x04034b50;
+constexpr uint32_t ZIP_CENTRAL_HEADER = 0x02014b50;
+constexpr uint32_t ZIP_END_OF_DIRECTORY = 0x06054b50;
+constexpr size_t TAR_BLOCK = 512;
+
+uint32_t readLE(std::string_view bytes, size_t pos, int width) {
+    if (pos + width > bytes.size()) {
+        throw std::runtime_error("Truncated archive");
+    }
+    uint32_t value = 0;
+    for (int i = width - 1; i >= 0; i--) {
+        value = (value << 8) | static_cast<unsigned char>(bytes[pos + i]);
+    }
+    return value;
+}
+
+uint64_t readOctal(std::string_view field) {
+    uint64_t value = 0;
+    for (char ch : field) {
+        if (ch == '\0' || ch == ' ') {
+            if (value) break;
+            continue;
+        }
+        if (ch < '0' || ch > '7') {
+            throw std::runtime_error("Malformed tar header");
+        }
+        value = value * 8 + (ch - '0');
+    }
+    return value;
+}
+
+std::string_view cString(std::string_view field) {
+    return field.substr(0, std::min(field.find('\0'), field.size()));
+}
+
+}  // namespace
+
+Archive::Archive(std::string_view bytes) : bytes(bytes) {
+    if (isZip(bytes)) {
+        indexZip();
+    } else if (isTar(bytes)) {
+        indexTar();
+    } else {
+        throw std::runtime_error("Not a zip or tar archive");
+    }
+}
+
+bool Archive::isZip(std::string_view bytes) {
+    return bytes.size() >= 22 && bytes.substr(0, 2) == "PK";
+}
+
+bool Archive::isTar(std::string_view bytes) {
+    return bytes.size() >= TAR_BLOCK && bytes.substr(257, 5) == "ustar";
+}
+
+void Archive::indexZip() {
+    // The end-of-directory record sits in the last 22 + 65535 bytes
+    size_t end = std::string_view::npos;
+    size_t lowest = bytes.size() > 22 + 0xFFFF ? bytes.size() - 22 - 0xFFFF : 0;
+    for (size_t pos = bytes.size() - 22 + 1; pos-- > lowest;) {
+        if (readLE(bytes, pos, 4) == ZIP_END_OF_DIRECTORY) {
+            end = pos;
+            break;
+        }
+    }
+    if (end == std::string_view::npos) {
+        throw std::runtime_error("Zip end of central directory not found");
+    }
+
+    const uint32_t count = readLE(bytes, end + 10, 2);
+    size_t pos = readLE(bytes, end + 16, 4);
+    if (count == 0xFFFF || pos == 0xFFFFFFFF) {
+        throw std::runtime_error("ZIP64 archives are not supported");
+    }
+
+    entries.reserve(count);
+    for (uint32_t i = 0; i < count; i++) {
+        if (readLE(bytes, pos, 4) != ZIP_CENTRAL_HEADER) {
+            throw std::runtime_error("Corrupt zip central directory");
+        }
+
+        Entry entry;
+        entry.method = static_cast<uint16_t>(readLE(bytes, pos + 10, 2));
+        entry.compressedSize = readLE(bytes, pos + 20, 4);
+        entry.size = readLE(bytes, pos + 24, 4);
+        const uint32_t nameLength = readLE(bytes, pos + 28, 2);
+        const uint32_t extraLength = readLE(bytes, pos + 30, 2);
+        const uint32_t commentLength = readLE(bytes, pos + 32, 2);
+        entry.offset = readLE(bytes, pos + 42, 4);
+        if (pos + 46 + nameLength > bytes.size()) {
+            throw std::runtime_error("Truncated archive");
+        }
+        entry.name = std::string(bytes.substr(pos + 46, nameLength));
+
+        if (entry.compressedSize == 0xFFFFFFFF || entry.size == 0xFFFFFFFF ||
+            entry.offset == 0xFFFFFFFF) {
+            throw std::runtime_error("ZIP64 archives are not supported");
+        }
+        if (!entry.name.empty() && entry.name.back() != '/') {
+            entries.push_back(std::move(entry));
+        }
+
+        pos += 46 + nameLength + extraLength + commentLength;
+    }
+}
+
+void Archive::indexTar() {
+    size_t pos = 0;
+    std::string longName;
+
+    while (pos + TAR_BLOCK <= bytes.size()) {
+        std::string_view header = bytes.substr(pos, TAR_BLOCK);
+        if (header[0] == '\0') break;  // end-of-archive blocks
+
+        const uint64_t size = readOctal(header.substr(124, 12));
+        const char type = header[156];
+        const size_t data = pos + TAR_BLOCK;
+        if (data + size > bytes.size()) {
+            throw std::runtime_error("Truncated archive");
+        }
+
+        if (type == 'L') {
+            // GNU long name: the data block holds the next entry's name
+            longName = std::string(cString(bytes.substr(data, size)));
+        } else {
+            if (type == '0' || type == '\0') {
+                std::string name = longName;
+                if (name.empty()) {
+                    std::string_view prefix = cString(header.substr(345, 155));
+                    name = std::string(cString(header.substr(0, 100)));
+                    if (!prefix.empty()) {
+                        name = std::string(prefix) + "/" + name;
+                    }
+                }
+                entries.push_back({name, 0, data, size, size});
+            }
+            longName.clear();
+        }
+
+        pos = data + (size + TAR_BLOCK - 1) / TAR_BLOCK * TAR_BLOCK;
+    }
+}
+
+const std::vector<Archive::Entry>& Archive::getEntries() const {
+    return entries;
+}
+
+const Archive::Entry* Archive::find(const std::string& name) const {
+    for (const Entry& entry : entries) {
+        if (entry.name == name) return &entry;
+    }
+    return nullptr;
+}
+
+std::string_view Archive::read(const Entry& entry, std::string& buffer) const {
+    size_t data = entry.offset;
+    if (isZip(bytes)) {
+        if (readLE(bytes, data, 4) != ZIP_LOCAL_HEADER) {
+            throw std::runtime_error("Corrupt zip entry: " + entry.name);
+        }
+        data += 30 + readLE(bytes, data + 26, 2) + readLE(bytes, data + 28, 2);
+    }
+    if (data + entry.compressedSize > bytes.size()) {
+        throw std::runtime_error("Truncated archive entry: " + entry.name);
+    }
+    std::string_view raw = bytes.substr(data, entry.compressedSize);
+
+    if (entry.method == 0) return raw;
+    if (entry.method != 8) {
+        throw std::runtime_error("Unsupported compression in " + entry.name);
+    }
+
+    buffer.resize(entry.size);
+    z_stream stream{};
+    if (inflateInit2(&stream, -MAX_WBITS) != Z_OK) {
+        throw std::runtime_error("Could not initialize inflate");
+    }
+    stream.next_in = reinterpret_cast<Bytef*>(const_cast<char*>(raw.data()));
+    stream.avail_in = static_cast<uInt>(raw.size());
+    stream.next_out = reinterpret_cast<Bytef*>(buffer.data());
+    stream.avail_out = static_cast<uInt>(buffer.size());
+
+    int status = inflate(&stream, Z_FINISH);
+    inflateEnd(&stream);
+    if (status != Z_STREAM_END || stream.total_out != entry.size) {
+        throw std::runtime_error("Corrupt deflate data in " + entry.name);
+    }
+
+    return buffer;
+}
+
+}  // namespace MaratonaScore
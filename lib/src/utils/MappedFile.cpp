@@ -0,0 +1,116 @@
+//    Copyright 2025 MaratonaCIn
+//
+//    Licensed under the Apache License, Version 2.0 (the "License");
+//    you may not use this file except in compliance with the License.
+//    You may obtain a copy of the License at
+//
+//        http://www.apache.org/licenses/LICENSE-2.0
+//
+//    Unless required by applicable law or agreed to in writing, software
+//    distributed under the License is distributed on an "AS IS" BASIS,
+//    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//    See the License for the specific language governing permissions and
+//    limitations under the License.
+
+
+#include "utils/MappedFile.hpp"
+
+#include <stdexcept>
+
+#ifdef _WIN32
+#ifndef NOMINMAX
+#define NOMINMAX
+#endif
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+namespace MaratonaScore {
+
+#ifdef _WIN32
+
+MappedFile::MappedFile(const std::string& path) {
+    HANDLE handle = CreateFileA(path.c_str(), GENERIC_READ, FILE_SHARE_READ,
+                                nullptr, OPEN_EXISTING,
+                                FILE_FLAG_SEQUENTIAL_SCAN, nullptr);
+    if (handle == INVALID_HANDLE_VALUE) {
+        throw std::runtime_error("Could not open file: " + path);
+    }
+    file = handle;
+
+    LARGE_INTEGER fileSize;
+    if (!GetFileSizeEx(handle, &fileSize)) {
+        CloseHandle(handle);
+        throw std::runtime_error("Could not stat file: " + path);
+    }
+    length = static_cast<size_t>(fileSize.QuadPart);
+    if (length == 0) return;
+
+    mapping = CreateFileMappingA(handle, nullptr, PAGE_READONLY, 0, 0, nullptr);
+    if (mapping) {
+        begin = static_cast<const char*>(
+            MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0));
+    }
+    if (!begin) {
+        if (mapping) CloseHandle(mapping);
+        CloseHandle(handle);
+        throw std::runtime_error("Could not map file: " + path);
+    }
+}
+
+MappedFile::~MappedFile() {
+    if (begin) UnmapViewOfFile(begin);
+    if (mapping) CloseHandle(mapping);
+    if (file) CloseHandle(file);
+}
+
+#else
+
+MappedFile::MappedFile(const std::string& path) {
+    fd = open(path.c_str(), O_RDONLY);
+    if (fd < 0) {
+        throw std::runtime_error("Could not open file: " + path);
+    }
+
+    struct stat st;
+    if (fstat(fd, &st) != 0) {
+        close(fd);
+        throw std::runtime_error("Could not stat file: " + path);
+    }
+    length = static_cast<size_t>(st.st_size);
+    if (length == 0) return;
+
+    void* address = mmap(nullptr, length, PROT_READ, MAP_PRIVATE, fd, 0);
+    if (address == MAP_FAILED) {
+        close(fd);
+        throw std::runtime_error("Could not map file: " + path);
+    }
+    // The archive is walked front to back once
+    madvise(address, length, MADV_SEQUENTIAL);
+    begin = static_cast<const char*>(address);
+}
+
+MappedFile::~MappedFile() {
+    if (begin) munmap(const_cast<char*>(begin), length);
+    if (fd >= 0) close(fd);
+}
+
+#endif
+
+const char* MappedFile::data() const {
+    return begin;
+}
+
+size_t MappedFile::size() const {
+    return length;
+}
+
+std::string_view MappedFile::view() const {
+    return {begin, length};
+}
+
+}  // namespace MaratonaScore
@@ -17,10 +17,22 @@
 #include <yaml-cpp/yaml.h>
 
 #include <iostream>
+#include <map>
 #include <stdexcept>
 
 namespace MaratonaScore {
 
+template <typename T>
+static T parseChoice(const YAML::Node& node,
+                     const std::map<std::string, T>& choices) {
+    std::string value = node.as<std::string>();
+    auto it = choices.find(value);
+    if (it == choices.end()) {
+        throw std::invalid_argument("Unknown scoring option: " + value);
+    }
+    return it->second;
+}
+
 Settings::Settings() { setDefaultValues(); }
 
 Settings& Settings::getInstance() {
@@ -49,6 +61,22 @@ void Settings::setDefaultValues() {
     // Contest settings
     IGNORE_WORST_CONTESTS = 2;
     NUMBER_OF_CONTESTS = 10;
+
+    // Scoring policies
+    SCORE_WEIGHTING = EXPONENTIAL_WEIGHTING;
+    SCORE_PROBLEM_VALUE = FLAT_VALUE;
+    SCORE_BONUS_SCHEDULE = LINEAR_BONUS;
+    DIFFICULTY_FACTOR = 1.0;
+
+    // Parser (0 = all hardware threads)
+    PARSER_THREADS = 0;
+
+    // Rating track
+    RATING_ENABLED = false;
+    RATING_INITIAL = 1500.0;
+
+    // Aliases
+    ALIAS_NORMALIZE_NAMES = false;
 }
 
 void Settings::loadFromFile(const std::string& filename) {
@@ -118,6 +146,56 @@ void Settings::loadFromFile(const std::string& filename) {
             }
         }
 
+        // Load scoring policies
+        if (config["scoring"]) {
+            if (config["scoring"]["weighting"]) {
+                SCORE_WEIGHTING = parseChoice<WEIGHTING_CURVE>(
+                    config["scoring"]["weighting"],
+                    {{"exponential", EXPONENTIAL_WEIGHTING},
+                     {"linear", LINEAR_WEIGHTING},
+                     {"flat", FLAT_WEIGHTING}});
+            }
+            if (config["scoring"]["problem_value"]) {
+                SCORE_PROBLEM_VALUE = parseChoice<PROBLEM_VALUE>(
+                    config["scoring"]["problem_value"],
+                    {{"flat", FLAT_VALUE}, {"difficulty", DIFFICULTY_VALUE}});
+            }
+            if (config["scoring"]["bonus"]) {
+                SCORE_BONUS_SCHEDULE = parseChoice<BONUS_SCHEDULE>(
+                    config["scoring"]["bonus"],
+                    {{"linear", LINEAR_BONUS}, {"geometric", GEOMETRIC_BONUS}});
+            }
+            if (config["scoring"]["difficulty_factor"]) {
+                DIFFICULTY_FACTOR =
+                    config["scoring"]["difficulty_factor"].as<double>();
+            }
+        }
+
+        // Load parser settings
+        if (config["parser"]) {
+            if (config["parser"]["threads"]) {
+                PARSER_THREADS = config["parser"]["threads"].as<int>();
+            }
+        }
+
+        // Load rating track
+        if (config["rating"]) {
+            if (config["rating"]["enabled"]) {
+                RATING_ENABLED = config["rating"]["enabled"].as<bool>();
+            }
+            if (config["rating"]["initial"]) {
+                RATING_INITIAL = config["rating"]["initial"].as<double>();
+            }
+        }
+
+        // Load alias resolution
+        if (config["aliases"]) {
+            if (config["aliases"]["normalize_names"]) {
+                ALIAS_NORMALIZE_NAMES =
+                    config["aliases"]["normalize_names"].as<bool>();
+            }
+        }
+
         std::cout << "Configuration loaded successfully from: " << filename
                   << std::endl;
     } catch (const YAML::Exception& e) {
@@ -14,6 +14,9 @@
 
 #include "utils/StringUtils.hpp"
 
+#include <cctype>
+#include <tuple>
+
 namespace MaratonaScore {
 
 int timeStringToMinutes(const std::string& timeStr) {
@@ -52,4 +55,63 @@ std::string trim(const std::string& s) {
     return (wsback <= wsfront ? std::string() : std::string(wsfront, wsback));
 }
 
+int contestSlot(const std::string& contestId, const std::string& prefix,
+                int slots) {
+    if (contestId.size() <= prefix.size() ||
+        contestId.compare(0, prefix.size(), prefix) != 0) {
+        return -1;
+    }
+    std::string digits = contestId.substr(prefix.size());
+    if (!std::all_of(digits.begin(), digits.end(),
+                     [](char ch) { return ch >= '0' && ch <= '9'; })) {
+        return -1;
+    }
+    int slot = std::stoi(digits) - 1;
+    return (slot >= 0 && slot < slots) ? slot : -1;
+}
+
+bool contestIdLess(const std::string& a, const std::string& b) {
+    auto key = [](const std::string& id) {
+        size_t digits = id.find_first_of("0123456789");
+        bool numeric = digits != std::string::npos &&
+                       std::all_of(id.begin() + digits, id.end(),
+                                   [](char ch) { return std::isdigit(
+                                                     static_cast<unsigned char>(ch)); });
+        int group = !numeric ? 2 : (digits == 0 ? 0 : 1);
+        long long number = numeric ? std::stoll(id.substr(digits)) : 0;
+        return std::make_tuple(group, id.substr(0, digits), number, id);
+    };
+    return key(a) < key(b);
+}
+
+uint64_t fnv1a(std::string_view data) {
+    uint64_t hash = 0xcbf29ce484222325ULL;
+    for (unsigned char ch : data) {
+        hash ^= ch;
+        hash *= 0x100000001b3ULL;
+    }
+    return hash;
+}
+
+void appendEscaped(std::string& out, std::string_view text) {
+    for (char ch : text) {
+        switch (ch) {
+            case '&':
+                out += "&amp;";
+                break;
+            case '<':
+                out += "&lt;";
+                break;
+            case '>':
+                out += "&gt;";
+                break;
+            case '"':
+                out += "&quot;";
+                break;
+            default:
+                out += ch;
+        }
+    }
+}
+
 }  // namespace MaratonaScore
@@ -0,0 +1,210 @@
+//    Copyright 2025 MaratonaCIn
+//
+//    Licensed under the Apache License, Version 2.0 (the "License");
+//    you may not use this file except in compliance with the License.
+//    You may obtain a copy of the License at
+//
+//        http://www.apache.org/licenses/LICENSE-2.0
+//
+//    Unless required by applicable law or agreed to in writing, software
+//    distributed under the License is distributed on an "AS IS" BASIS,
+//    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//    See the License for the specific language governing permissions and
+//    limitations under the License.
+
+
+#include "utils/ZipWriter.hpp"
+
+#include <zlib.h>
+
+#include <algorithm>
+#include <limits>
+#include <stdexcept>
+
+namespace MaratonaScore {
+
+namespace {
+
+constexpr uint32_t LOCAL_HEADER = 0x04034b50;
+constexpr uint32_t DATA_DESCRIPTOR = 0x08074b50;
+constexpr uint32_t CENTRAL_HEADER = 0x02014b50;
+constexpr uint32_t END_OF_CENTRAL = 0x06054b50;
+
+constexpr uint16_t VERSION = 20;
+constexpr uint16_t FLAGS = 0x0808;  // data descriptor, UTF-8 names
+constexpr uint16_t DEFLATE = 8;
+constexpr uint16_t DOS_DATE = 0x0021;  // 1980-01-01, keeps output reproducible
+
+constexpr size_t CHUNK_SIZE = 1 << 16;
+
+}  // namespace
+
+struct ZipWriter::Deflater {
+    z_stream stream{};
+    uint32_t crc = 0;
+    uint64_t size = 0;
+    uint64_t compressedSize = 0;
+};
+
+ZipWriter::ZipWriter(std::ostream& os, int level)
+    : os(os), level(level), chunk(CHUNK_SIZE) {}
+
+ZipWriter::~ZipWriter() {
+    if (deflater) deflateEnd(&deflater->stream);
+}
+
+void ZipWriter::put(const void* data, size_t size) {
+    os.write(static_cast<const char*>(data), static_cast<std::streamsize>(size));
+    written += size;
+}
+
+void ZipWriter::put16(uint16_t value) {
+    unsigned char bytes[2] = {static_cast<unsigned char>(value),
+                              static_cast<unsigned char>(value >> 8)};
+    put(bytes, 2);
+}
+
+void ZipWriter::put32(uint32_t value) {
+    put16(static_cast<uint16_t>(value));
+    put16(static_cast<uint16_t>(value >> 16));
+}
+
+void ZipWriter::beginEntry(const std::string& name) {
+    if (deflater) throw std::logic_error("Previous zip entry is still open");
+    if (entries.size() == std::numeric_limits<uint16_t>::max()) {
+        throw std::runtime_error("Too many zip entries");
+    }
+    if (written > std::numeric_limits<uint32_t>::max()) {
+        throw std::runtime_error("Zip archive larger than 4 GiB");
+    }
+
+    entries.push_back({name, 0, 0, 0, static_cast<uint32_t>(written)});
+
+    put32(LOCAL_HEADER);
+    put16(VERSION);
+    put16(FLAGS);
+    put16(DEFLATE);
+    put16(0);  // time
+    put16(DOS_DATE);
+    put32(0);  // crc and sizes follow in the data descriptor
+    put32(0);
+    put32(0);
+    put16(static_cast<uint16_t>(name.size()));
+    put16(0);  // extra field
+    put(name.data(), name.size());
+
+    deflater = std::make_unique<Deflater>();
+    deflater->crc = crc32(0, Z_NULL, 0);
+    if (deflateInit2(&deflater->stream, level, Z_DEFLATED, -MAX_WBITS, 8,
+                     Z_DEFAULT_STRATEGY) != Z_OK) {
+        deflater.reset();
+        throw std::runtime_error("Could not initialize deflate");
+    }
+}
+
+void ZipWriter::drain(int flush) {
+    z_stream& stream = deflater->stream;
+    int status;
+    do {
+        stream.next_out = reinterpret_cast<Bytef*>(chunk.data());
+        stream.avail_out = static_cast<uInt>(chunk.size());
+        status = deflate(&stream, flush);
+        if (status == Z_STREAM_ERROR) {
+            throw std::runtime_error("Deflate failed");
+        }
+
+        size_t produced = chunk.size() - stream.avail_out;
+        put(chunk.data(), produced);
+        deflater->compressedSize += produced;
+    } while (stream.avail_out == 0 || (flush == Z_FINISH && status != Z_STREAM_END));
+}
+
+void ZipWriter::write(std::string_view data) {
+    if (!deflater) throw std::logic_error("No open zip entry");
+
+    while (!data.empty()) {
+        // zlib counts in uInt; feed very large buffers in pieces
+        size_t piece = std::min<size_t>(data.size(), 1u << 30);
+
+        deflater->crc = crc32(deflater->crc,
+                              reinterpret_cast<const Bytef*>(data.data()),
+                              static_cast<uInt>(piece));
+        deflater->size += piece;
+
+        deflater->stream.next_in =
+            reinterpret_cast<Bytef*>(const_cast<char*>(data.data()));
+        deflater->stream.avail_in = static_cast<uInt>(piece);
+        drain(Z_NO_FLUSH);
+
+        data.remove_prefix(piece);
+    }
+}
+
+void ZipWriter::endEntry() {
+    if (!deflater) throw std::logic_error("No open zip entry");
+
+    deflater->stream.next_in = nullptr;
+    deflater->stream.avail_in = 0;
+    drain(Z_FINISH);
+    deflateEnd(&deflater->stream);
+
+    if (deflater->size > std::numeric_limits<uint32_t>::max() ||
+        deflater->compressedSize > std::numeric_limits<uint32_t>::max()) {
+        deflater.reset();
+        throw std::runtime_error("Zip entry larger than 4 GiB");
+    }
+
+    Entry& entry = entries.back();
+    entry.crc = deflater->crc;
+    entry.compressedSize = static_cast<uint32_t>(deflater->compressedSize);
+    entry.size = static_cast<uint32_t>(deflater->size);
+    deflater.reset();
+
+    put32(DATA_DESCRIPTOR);
+    put32(entry.crc);
+    put32(entry.compressedSize);
+    put32(entry.size);
+}
+
+void ZipWriter::finish() {
+    if (deflater) endEntry();
+    if (written > std::numeric_limits<uint32_t>::max()) {
+        throw std::runtime_error("Zip archive larger than 4 GiB");
+    }
+
+    const uint64_t directoryOffset = written;
+    for (const Entry& entry : entries) {
+        put32(CENTRAL_HEADER);
+        put16(VERSION);  // made by
+        put16(VERSION);  // needed
+        put16(FLAGS);
+        put16(DEFLATE);
+        put16(0);
+        put16(DOS_DATE);
+        put32(entry.crc);
+        put32(entry.compressedSize);
+        put32(entry.size);
+        put16(static_cast<uint16_t>(entry.name.size()));
+        put16(0);  // extra field
+        put16(0);  // comment
+        put16(0);  // disk
+        put16(0);  // internal attributes
+        put32(0);  // external attributes
+        put32(entry.offset);
+        put(entry.name.data(), entry.name.size());
+    }
+    const uint64_t directorySize = written - directoryOffset;
+
+    put32(END_OF_CENTRAL);
+    put16(0);
+    put16(0);
+    put16(static_cast<uint16_t>(entries.size()));
+    put16(static_cast<uint16_t>(entries.size()));
+    put32(static_cast<uint32_t>(directorySize));
+    put32(static_cast<uint32_t>(directoryOffset));
+    put16(0);
+
+    os.flush();
+}
+
+}  // namespace MaratonaScore